@@ -32,4 +32,81 @@ void MamOS_init(void);
  ====================================================================================================================*/
 void MamOS_launch(void);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTickCount
+ * [Description]   : Gets the number of system ticks since the kernel was launched.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the current system tick count.
+ ====================================================================================================================*/
+uint64 MamOS_getTickCount(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_enterCritical
+ * [Description]   : Enters a kernel critical section by masking the interrupts at or below the kernel priority
+ *                   ceiling [MAMOS_MAX_SYSCALL_PRIORITY] using BASEPRI, The higher priority interrupts are never
+ *                   masked. The critical sections can be nested [privileged code only].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_enterCritical(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_exitCritical
+ * [Description]   : Exits a kernel critical section, The mask the caller had before the outermost critical
+ *                   section is restored only when that critical section is exited.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_exitCritical(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMaxCriticalCycles
+ * [Description]   : Gets the longest masked window of the kernel critical sections since the last reading, Then
+ *                   resets it [so the window of a specific kernel API can be measured between two readings].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the longest critical section in CPU cycles [zero if not profiled].
+ ====================================================================================================================*/
+uint32 MamOS_getMaxCriticalCycles(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_kernelCall
+ * [Description]   : Runs a kernel function in handler mode inside a kernel critical section, So the unprivileged
+ *                   tasks can modify the kernel state safely [it must not be called inside a critical section].
+ * [Arguments]     : <a_ptr2function> -> Pointer to the kernel function to be called.
+ *                   <a_ptr2argument> -> Pointer to the argument passed to the kernel function.
+ * [return]        : The function returns the value returned by the kernel function.
+ ====================================================================================================================*/
+uint32 MamOS_kernelCall(MamOS_kernelCallType a_ptr2function, void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_executeKernelCall
+ * [Description]   : Executes a kernel call requested by MamOS_kernelCall [called from the SVC handler], The kernel
+ *                   function runs in handler mode, So it requests the switch to a task it wakes the same way as an
+ *                   interrupt does [MamOS_yieldFromISR].
+ * [Arguments]     : <a_ptr2stackFrame> -> Pointer to the exception stack frame of the calling task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_executeKernelCall(uint32* a_ptr2stackFrame);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_stackOverflowHandler
+ * [Description]   : Handles a stack overflow detected on a context switch [the lowest word of the switched out
+ *                   task stack lost its paint], It halts the system by default, And it's a weak function, So the
+ *                   application can override it to report the task or to reset the system.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the task that overflowed its stack.
+ * [return]        : The function never returns.
+ ====================================================================================================================*/
+void MamOS_stackOverflowHandler(MamOS_taskHandle a_ptr2task);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_memoryFaultHandler
+ * [Description]   : Handles a memory access denied by the MPU [a stack overflow into the stack guard or an access
+ *                   to a protected data region], It halts the system by default, And it's a weak function, So the
+ *                   application can override it to report the task or to reset the system.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the task that caused the fault.
+ *                   <a_faultAddress>       -> Indicates to the denied address [or zero if it's not known].
+ * [return]        : The function never returns.
+ ====================================================================================================================*/
+void MamOS_memoryFaultHandler(MamOS_taskHandle a_ptr2task, uint32 a_faultAddress);
+
 #endif /* MAMOS_CORE_INCLUDES_CORE_H_ */
@@ -12,6 +12,52 @@ Description  : Private file for the MamOS Core Module.
 #ifndef MAMOS_CORE_INCLUDES_CORE_PRV_H_
 #define MAMOS_CORE_INCLUDES_CORE_PRV_H_
 
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+#if defined(__ARM_FP)
+/* Save the FPU callee-saved registers only if the task used the FPU [EXC_RETURN bit 4 is cleared]. */
+#define MAMOS_SAVE_FPU_CONTEXT(SP)            "TST       LR, #0X10                 \n" \
+                                              "IT        EQ                        \n" \
+                                              "VSTMDBEQ  " SP "!, {S16-S31}        \n"
+
+/* Restore the FPU callee-saved registers only if the task used the FPU [EXC_RETURN bit 4 is cleared]. */
+#define MAMOS_RESTORE_FPU_CONTEXT(SP)         "TST       LR, #0X10                 \n" \
+                                              "IT        EQ                        \n" \
+                                              "VLDMIAEQ  " SP "!, {S16-S31}        \n"
+#else
+/* There are no FPU registers to be saved or restored when the FPU is not used by the compiler. */
+#define MAMOS_SAVE_FPU_CONTEXT(SP)            ""
+#define MAMOS_RESTORE_FPU_CONTEXT(SP)         ""
+#endif
+
+#if (MAMOS_STACK_CANARY_CHECK == TRUE)
+/* Check the lowest word of the switched out task stack, It loses its paint only if the stack overflowed. */
+#define MAMOS_CHECK_STACK_CANARY(TCB)         "LDR       R12, [" TCB ", %[stackBase]] \n" \
+                                              "LDR       R12, [R12]                \n" \
+                                              "CMP       R12, %[fillPattern]       \n" \
+                                              "ITT       NE                        \n" \
+                                              "MOVNE     R0, " TCB "               \n" \
+                                              "BNE       MamOS_stackOverflowHandler\n"
+#else
+/* The stack canary is not checked on the context switch. */
+#define MAMOS_CHECK_STACK_CANARY(TCB)         ""
+#endif
+
+#if (MAMOS_MPU_PROTECTION == TRUE)
+/* Program the MPU regions of the new task [its guard and data RBAR/RASR pairs through the MPU alias registers]. */
+#define MAMOS_SWITCH_MPU_REGIONS(TCB)         "ADD       R1, " TCB ", %[mpuRegions] \n" \
+                                              "LDMIA     R1, {R4-R9}               \n" \
+                                              "LDR       R1, =0XE000ED9C           \n" \
+                                              "STMIA     R1, {R4-R9}               \n" \
+                                              "DSB                                 \n" \
+                                              "ISB                                 \n"
+#else
+/* There are no MPU regions to be switched when the memory protection is disabled. */
+#define MAMOS_SWITCH_MPU_REGIONS(TCB)         ""
+#endif
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
@@ -19,6 +19,7 @@ Description  : Source file for the MamOS Core Module.
                                                < Includes >
 =====================================================================================================================*/
 
+#include <stddef.h>
 #include "../../MamOSConfig.h"
 #include "../../Others/std_types.h"
 #include "../../Others/kernel_defs.h"
@@ -28,6 +29,7 @@ Description  : Source file for the MamOS Core Module.
 #include "../../Scheduler/INCLUDES/scheduler.h"
 #include "../../Queue/INCLUDES/queue.h"
 #include "../../Task/INCLUDES/task.h"
+#include "../../EventGroup/INCLUDES/event_group.h"
 #include "../INCLUDES/core_prv.h"
 #include "../INCLUDES/core.h"
 
@@ -38,6 +40,11 @@ Description  : Source file for the MamOS Core Module.
 /* Kernel Control Panel that maintains the entire system state. */
 volatile MamOS_kernelControlPanelType G_kernelControlPanel = {0};
 
+#if (MAMOS_CRITICAL_PROFILING == TRUE)
+static uint32 G_criticalStartCycle = 0;                       /* CPU cycle count at the outermost critical entry. */
+static uint32 G_maxCriticalCycles = 0;                        /* Longest critical section since the last reading. */
+#endif
+
 /*=====================================================================================================================
                                           < Functions Definitions >
 =====================================================================================================================*/
@@ -57,18 +64,39 @@ void MamOS_init(void)
     /* Set the PendSV interrupt periority to be the lowest interrupt priority in the system. */
     SYSTEM_setExceptionPriority(SYSTEM_PENDSV_EXCEPTION, 0XFF);
 
+    /* Set the SVCall periority to be the lowest too, So the interrupts above the kernel priority ceiling can
+     * preempt the system calls, and the SysTick interrupt can wake the core up from a tickless idle. */
+    SYSTEM_setExceptionPriority(SYSTEM_SVCALL_EXCEPTION, 0XFF);
+
+    /* Set the SysTick periority to be the kernel priority ceiling, So the kernel critical sections can mask it. */
+    SYSTEM_setExceptionPriority(SYSTEM_SYSTICK_EXCEPTION, MAMOS_MAX_SYSCALL_PRIORITY);
+
+    #if (MAMOS_CRITICAL_PROFILING == TRUE)
+    SYSTEM_enableCycleCounter();
+    #endif
+
     /* Initialize Kernel Control Panel parameters. */
     G_kernelControlPanel.taskCounter = 0;
     G_kernelControlPanel.ticksCounter = 0;
+    G_kernelControlPanel.checkedTick = 0;
     G_kernelControlPanel.mutexCounter = 0;
+    G_kernelControlPanel.ringBufferCounter = 0;
+    G_kernelControlPanel.messageQueueCounter = 0;
+    G_kernelControlPanel.semaphoreCounter = 0;
+    G_kernelControlPanel.eventGroupCounter = 0;
+    G_kernelControlPanel.deferredEventsFlag = FALSE;
+    G_kernelControlPanel.memoryPoolCounter = 0;
+    G_kernelControlPanel.sliceTicksCounter = 0;
+    G_kernelControlPanel.criticalNesting = 0;
+    G_kernelControlPanel.savedBasePriority = 0;
     G_kernelControlPanel.blockEmptyFlag = TRUE;
     G_kernelControlPanel.ptr2activeTask = NULL_PTR;
     G_kernelControlPanel.ptr2standbyTask = NULL_PTR;
-    G_kernelControlPanel.readyQueue.ptr2headTask = NULL_PTR;
-    G_kernelControlPanel.blockedQueue.ptr2headTask = NULL_PTR;
+    MamOS_initBlockedQueue();
+    MamOS_initReadyQueue();
     
-    /* Create the system idle task with lowest priority [(uint8)-1 = 255]. */
-    MamOS_createTask(MamOS_idleTask, MAMOS_MIN_STACK_SIZE, (uint8)-1, 0);
+    /* Create the system idle task with lowest priority [(uint8)-1 = 255], It never uses the FPU. */
+    MamOS_createTask(MamOS_idleTask, MAMOS_MIN_STACK_SIZE, (uint8)-1, 0, MAMOS_TASK_FPU_FREE);
 }
 
 /*=====================================================================================================================
@@ -80,17 +108,33 @@ void MamOS_init(void)
 void MamOS_launch(void)
 {
     /* Load the initial task [the highest priority task] and remove it from the ready queue. */
-    G_kernelControlPanel.ptr2activeTask = G_kernelControlPanel.readyQueue.ptr2headTask;
+    G_kernelControlPanel.ptr2activeTask = MamOS_getHighestReadyTask();
     MamOS_removeFromReadyQueue(G_kernelControlPanel.ptr2activeTask);
+    G_kernelControlPanel.ptr2activeTask->state = MAMOS_ACTIVE_TASK;
+    G_kernelControlPanel.ptr2standbyTask = G_kernelControlPanel.ptr2activeTask;    /* No context switch is pending. */
 
     /* Configure the system timer with a specific scheduler tick time. */
     TIMER_setPeriodicInterval(MAMOS_SCHEDULER_TICK_TIME);
 
-    /* Set the stack pointer of the initial task as the system PSP. */
-    __asm__ volatile ("LDR R2, =G_kernelControlPanel");
-    __asm__ volatile ("LDR R2, [R2, #8]");
-    __asm__ volatile ("LDR R2, [R2, #8]");
-    __asm__ volatile ("MSR PSP, R2");
+    /* Grant the FPU access to the whole core [the interrupts and the kernel may use it too], The FPU context of the
+     * FPU tasks is stacked lazily and switched only if EXC_RETURN bit 4 shows that the task used the FPU. */
+    #if defined(__ARM_FP)
+    SYSTEM_setFpuAccess(TRUE);
+    #endif
+
+    /* Program the stack guard and the data regions of the initial task, Then enable the MPU. */
+    #if (MAMOS_MPU_PROTECTION == TRUE)
+    for(uint8 LOC_regionIndex = 0; LOC_regionIndex <= MAMOS_MPU_NUM_OF_DATA_REGIONS; LOC_regionIndex++)
+    {
+        SYSTEM_setMemoryRegion(G_kernelControlPanel.ptr2activeTask->mpuRegions[2U * LOC_regionIndex], G_kernelControlPanel.ptr2activeTask->mpuRegions[(2U * LOC_regionIndex) + 1U]);
+    }
+
+    SYSTEM_enableMemoryProtection();
+    #endif
+
+    /* Set the hardware frame of the initial task as the system PSP [past R4-R11 and EXC_RETURN], The hardware frame
+     * is 8 words, So the stack of the initial task stays 8-byte aligned. */
+    __asm__ volatile ("MSR PSP, %0" :: "r" (G_kernelControlPanel.ptr2activeTask->stackPointer + MAMOS_SOFTWARE_FRAME_SIZE));
 
     /* Configure the system to run in unprivileged mode with PSP. */
     __asm__ volatile ("MSR CONTROL, %0" :: "r" (0X03));
@@ -102,6 +146,264 @@ void MamOS_launch(void)
     while(1);                                              /* Safety infinite loop [system should never reach here]. */
 }
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTickCount
+ * [Description]   : Gets the number of system ticks since the kernel was launched.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the current system tick count.
+ ====================================================================================================================*/
+uint64 MamOS_getTickCount(void)
+{
+    uint64 LOC_tickCount = 0;
+
+    /* The 64-bit counter is read in two words, So read it again if a tick interrupt updated it in between. */
+    do
+    {
+        LOC_tickCount = G_kernelControlPanel.ticksCounter;
+    }while(LOC_tickCount != G_kernelControlPanel.ticksCounter);
+
+    return LOC_tickCount;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_enterCritical
+ * [Description]   : Enters a kernel critical section by masking the interrupts at or below the kernel priority
+ *                   ceiling [MAMOS_MAX_SYSCALL_PRIORITY] using BASEPRI, The higher priority interrupts are never
+ *                   masked. The critical sections can be nested [privileged code only].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_enterCritical(void)
+{
+    uint32 LOC_basePriority = 0;
+
+    /* BASEPRI_MAX only raises the mask, So a caller already masking above the kernel ceiling is not unmasked. */
+    __asm__ volatile ("MRS %0, BASEPRI" : "=r" (LOC_basePriority));
+    __asm__ volatile ("MSR BASEPRI_MAX, %0" :: "r" (MAMOS_MAX_SYSCALL_PRIORITY) : "memory");
+    __asm__ volatile ("DSB");
+    __asm__ volatile ("ISB");
+
+    if(G_kernelControlPanel.criticalNesting == 0)
+    {
+        G_kernelControlPanel.savedBasePriority = (uint8)LOC_basePriority;
+
+        #if (MAMOS_CRITICAL_PROFILING == TRUE)
+        G_criticalStartCycle = SYSTEM_getCycleCount();                 /* The masked window starts at the outermost. */
+        #endif
+    }
+
+    G_kernelControlPanel.criticalNesting++;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_exitCritical
+ * [Description]   : Exits a kernel critical section, The mask the caller had before the outermost critical
+ *                   section is restored only when that critical section is exited.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_exitCritical(void)
+{
+    if(G_kernelControlPanel.criticalNesting == 0)
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        G_kernelControlPanel.criticalNesting--;
+
+        if(G_kernelControlPanel.criticalNesting == 0)
+        {
+            #if (MAMOS_CRITICAL_PROFILING == TRUE)
+            uint32 LOC_criticalCycles = SYSTEM_getCycleCount() - G_criticalStartCycle;
+
+            if(LOC_criticalCycles > G_maxCriticalCycles)
+            {
+                G_maxCriticalCycles = LOC_criticalCycles;
+            }
+            #endif
+
+            __asm__ volatile ("MSR BASEPRI, %0" :: "r" (G_kernelControlPanel.savedBasePriority) : "memory");
+        }
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMaxCriticalCycles
+ * [Description]   : Gets the longest masked window of the kernel critical sections since the last reading, Then
+ *                   resets it [so the window of a specific kernel API can be measured between two readings].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the longest critical section in CPU cycles [zero if not profiled].
+ ====================================================================================================================*/
+uint32 MamOS_getMaxCriticalCycles(void)
+{
+    uint32 LOC_maxCriticalCycles = 0;
+
+    #if (MAMOS_CRITICAL_PROFILING == TRUE)
+    LOC_maxCriticalCycles = G_maxCriticalCycles;
+    G_maxCriticalCycles = 0;
+    #endif
+
+    return LOC_maxCriticalCycles;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_kernelCall
+ * [Description]   : Runs a kernel function in handler mode inside a kernel critical section, So the unprivileged
+ *                   tasks can modify the kernel state safely [it must not be called inside a critical section].
+ * [Arguments]     : <a_ptr2function> -> Pointer to the kernel function to be called.
+ *                   <a_ptr2argument> -> Pointer to the argument passed to the kernel function.
+ * [return]        : The function returns the value returned by the kernel function.
+ ====================================================================================================================*/
+__attribute__((naked)) uint32 MamOS_kernelCall(MamOS_kernelCallType a_ptr2function, void* a_ptr2argument)
+{
+    __asm__ volatile
+    (
+        "SVC       %[immediate]                        \n"     /* The arguments are passed in R0 and R1.       */
+        "BX        LR                                  \n"     /* The result is returned in the stacked R0.    */
+        ::
+        [immediate] "I" (MAMOS_KERNEL_CALL_REQUEST_SVC)
+    );
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_executeKernelCall
+ * [Description]   : Executes a kernel call requested by MamOS_kernelCall [called from the SVC handler], The kernel
+ *                   function runs in handler mode, So it requests the switch to a task it wakes the same way as an
+ *                   interrupt does [MamOS_yieldFromISR].
+ * [Arguments]     : <a_ptr2stackFrame> -> Pointer to the exception stack frame of the calling task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_executeKernelCall(uint32* a_ptr2stackFrame)
+{
+    MamOS_kernelCallType LOC_ptr2function = (MamOS_kernelCallType)a_ptr2stackFrame[0];
+    uint8 LOC_revokedFlag = FALSE;
+
+    MamOS_enterCritical();
+
+    /* The kernel functions may queue the active task, So a switch selected before the critical section is
+     * cancelled first, Then selected again after the kernel function if the task still precedes. */
+    LOC_revokedFlag = MamOS_revokeStandbyTask();
+    a_ptr2stackFrame[0] = LOC_ptr2function((void*)a_ptr2stackFrame[1]);      /* Return the result in stacked R0. */
+    MamOS_yieldFromISR(LOC_revokedFlag);
+
+    MamOS_exitCritical();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : PendSV_Handler
+ * [Description]   : The exception service routine for PendSV, It processes the event bits set from interrupts
+ *                   [if any], Then switches the context from the active task to the standby task [the FPU
+ *                   context is only switched for the tasks that used the FPU]. The stack bottom of the active
+ *                   task is checked if enabled, And the MPU regions of the new task are programmed if the memory
+ *                   protection is enabled.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+__attribute__((naked)) void PendSV_Handler(void)
+{
+    __asm__ volatile
+    (
+        "LDR       R0, =G_kernelControlPanel           \n"     /* Load address of kernel control panel.        */
+        "LDRB      R1, [R0, %[deferredEvents]]         \n"     /* Check the event bits set from interrupts.    */
+        "CBZ       R1, 2f                              \n"
+        "PUSH      {R0, LR}                            \n"     /* Save the task EXC_RETURN value.              */
+        "BL        MamOS_processDeferredEventBits      \n"     /* Release the waiting tasks out of the ISRs.   */
+        "POP       {R0, LR}                            \n"     /* Restore the task EXC_RETURN value.           */
+
+        "2:                                            \n"
+        "MOV       R0, %[maxSyscallPriority]           \n"     /* Mask the kernel interrupts during the switch */
+        "MSR       BASEPRI, R0                         \n"     /* [up to the kernel priority ceiling].         */
+        "ISB                                           \n"
+        "LDR       R0, =G_kernelControlPanel           \n"     /* Load address of kernel control panel.        */
+        "LDR       R1, [R0, %[activeTask]]             \n"     /* Load the active task TCB.                    */
+        "LDR       R2, [R0, %[standbyTask]]            \n"     /* Load the standby task TCB.                   */
+        "CMP       R1, R2                              \n"     /* Skip the switch if it's the same task.       */
+        "BEQ       1f                                  \n"
+
+        "MRS       R3, PSP                             \n"     /* Get the stack pointer of the active task.    */
+        MAMOS_SAVE_FPU_CONTEXT("R3")                            /* Save S16-S31 if the active task used FPU.    */
+        "STMDB     R3!, {R4-R11, LR}                   \n"     /* Save R4-R11 and the task EXC_RETURN value.   */
+        "STR       R3, [R1, %[stackPointer]]           \n"     /* Save the stack pointer in the active TCB.    */
+        MAMOS_CHECK_STACK_CANARY("R1")                          /* Check the stack bottom of the active task.   */
+
+        "STR       R2, [R0, %[activeTask]]             \n"     /* Update active task with standby task.        */
+        MAMOS_SWITCH_MPU_REGIONS("R2")                          /* Set the MPU regions of the new task.         */
+        "LDR       R3, [R2, %[stackPointer]]           \n"     /* Load the stack pointer of the new task.      */
+        "LDMIA     R3!, {R4-R11, LR}                   \n"     /* Restore R4-R11 and the task EXC_RETURN.      */
+        MAMOS_RESTORE_FPU_CONTEXT("R3")                         /* Restore S16-S31 if the new task used FPU.    */
+        "MSR       PSP, R3                             \n"     /* Update PSP to the stack pointer of new task. */
+
+        "1:                                            \n"
+        "MOV       R0, #0                              \n"     /* Unmask the kernel interrupts after the       */
+        "MSR       BASEPRI, R0                         \n"     /* context switch.                              */
+        "BX        LR                                  \n"     /* Return from exception to the new task.       */
+        ::
+        [activeTask] "i" (offsetof(MamOS_kernelControlPanelType, ptr2activeTask)),
+        [standbyTask] "i" (offsetof(MamOS_kernelControlPanelType, ptr2standbyTask)),
+        [stackPointer] "i" (offsetof(MamOS_taskControlBlockType, stackPointer)),
+        [maxSyscallPriority] "i" (MAMOS_MAX_SYSCALL_PRIORITY),
+        [deferredEvents] "i" (offsetof(MamOS_kernelControlPanelType, deferredEventsFlag)),
+        [stackBase] "i" (offsetof(MamOS_taskControlBlockType, ptr2stackBase)),
+        [fillPattern] "i" (MAMOS_STACK_FILL_PATTERN),
+        [mpuRegions] "i" (offsetof(MamOS_taskControlBlockType, mpuRegions))
+    );
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_stackOverflowHandler
+ * [Description]   : Handles a stack overflow detected on a context switch [the lowest word of the switched out
+ *                   task stack lost its paint], It halts the system by default, And it's a weak function, So the
+ *                   application can override it to report the task or to reset the system.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the task that overflowed its stack.
+ * [return]        : The function never returns.
+ ====================================================================================================================*/
+__attribute__((weak)) void MamOS_stackOverflowHandler(MamOS_taskHandle a_ptr2task)
+{
+    (void)a_ptr2task;                                               /* Only an application handler reports the task. */
+
+    /* The stack of the task is corrupted, So the system is halted with the kernel interrupts masked. */
+    while(1)
+    {
+    }
+}
+
+#if (MAMOS_MPU_PROTECTION == TRUE)
+/*=====================================================================================================================
+ * [Function Name] : MemManage_Handler
+ * [Description]   : The exception service routine for the MemManage fault, The MPU faults synchronously on the
+ *                   denied access [or on stacking an exception frame into the stack guard], So the faulting task is
+ *                   the active task.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MemManage_Handler(void)
+{
+    MamOS_memoryFaultHandler(G_kernelControlPanel.ptr2activeTask, SYSTEM_getMemoryFaultAddress());
+}
+#endif
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_memoryFaultHandler
+ * [Description]   : Handles a memory access denied by the MPU [a stack overflow into the stack guard or an access
+ *                   to a protected data region], It halts the system by default, And it's a weak function, So the
+ *                   application can override it to report the task or to reset the system.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the task that caused the fault.
+ *                   <a_faultAddress>       -> Indicates to the denied address [or zero if it's not known].
+ * [return]        : The function never returns.
+ ====================================================================================================================*/
+__attribute__((weak)) void MamOS_memoryFaultHandler(MamOS_taskHandle a_ptr2task, uint32 a_faultAddress)
+{
+    (void)a_ptr2task;                                               /* Only an application handler reports the task. */
+    (void)a_faultAddress;                                           /* The denied address too.                       */
+
+    /* The task accessed a memory that is not granted to it, So the system is halted. */
+    while(1)
+    {
+    }
+}
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_idleTask
  * [Description]   : System idle task that runs when no other tasks are ready.
@@ -112,6 +414,10 @@ static void MamOS_idleTask(void)
 {
     while(1)
     {
+        #if (MAMOS_TICKLESS_IDLE == TRUE)
+        MAMOS_TICKLESS_IDLE_REQUEST();        /* Suppress the ticks and sleep until the nearest task wake-up.        */
+        #else
         __asm__ volatile ("WFE");             /* WFE: Wait For Event - puts the processor into low-power sleep mode. */
+        #endif
     }
 }
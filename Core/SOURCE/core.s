@@ -8,53 +8,17 @@
 
 
 ;======================================================================================================================
-; [Details]    : This file hosts the implementation of the PendSV and SVC handlers that manage task context switching
-;                and system calls in MamOS. It handles saving and restoring task contexts during switches.
+; [Details]    : This file hosts the implementation of the SVC handler that dispatches the system calls in MamOS.
+;                The PendSV handler lives in core.c so it can take the kernel structure offsets from offsetof.
 ;======================================================================================================================
 
     AREA      |.text|, CODE, READONLY, ALIGN=2
     IMPORT    MamOS_forceTaskTransition             ; Extern a C function for task switching.
-    EXTERN    G_kernelControlPanel                  ; Extern the kernel control panel.
-	EXPORT	  PendSV_Handler                        ; Export PendSV handler.
+    IMPORT    MamOS_enterTicklessIdle               ; Extern a C function for tickless idle.
+    IMPORT    MamOS_forceTaskTransitionUntil        ; Extern a C function for task switching until release.
+    IMPORT    MamOS_executeKernelCall               ; Extern a C function for kernel calls.
 	EXPORT	  SVC_Handler                           ; Export SVC handler.
 
-;======================================================================================================================
-; [Function Name] : PendSV_Handler
-; [Description]   : The exception service routine for PendSV.
-; [Arguments]     : The function Takes no arguments.
-; [return]        : The function returns void.
-;======================================================================================================================
-PendSV_Handler
-                                                    ; Enter a critical section.
-    CPSID     I                                     ; Disable interrupts during context switch.
-
-                                                    ; Save the stack frame [manual part] of the current task.
-    MRS       R1, PSP                               ; Get the stack pointer of the current task.
-    STMDB     R1!, {R4-R11}                         ; Save the values of R4-R11 in the current task stack.
-
-                                                    ; Save the current PSP value in the TCB of the current task.
-    LDR       R2, =G_kernelControlPanel             ; Load address of kernel control panel.
-    LDR       R2, [R2, #8]                          ; Move to the address of the active task TCB.
-    STR       R1, [R2, #8]                          ; Save the stack pointer value in the TCB.
-
-                                                    ; Update active task with standby task.
-    LDR       R0, =G_kernelControlPanel             ; Load address of kernel control panel.
-    LDR       R3, =G_kernelControlPanel             ; Load address of kernel control panel.
-    LDR       R3, [R3, #12]                         ; Move to the address of the standby task TCB.
-    STR       R3, [R0, #8]                          ; Update active task with standby task.
-
-                                                    ; Load the stack pointer value of the new active task.
-    LDR       R2, =G_kernelControlPanel             ; Load address of kernel control panel.
-    LDR       R2, [R2, #8]                          ; Move to the address of the new active task TCB.
-    LDR       R2, [R2, #8]                          ; Load the stack pointer value of the new active task.
-
-                                                    ; Load the stack frame [manual part] of the new task.
-    LDMIA     R2!, {R4-R11}                         ; Restore the values of R4-R11 from the new task stack.
-    MSR       PSP, R2                               ; Update PSP to the stack pointer of the new task.
-
-    CPSIE     I                                     ; Re-enable interrupts after context switch [critical section end].
-    BX        LR                                    ; Return from exception to the new task.
-
 ;======================================================================================================================
 ; [Function Name] : SVC_Handler
 ; [Description]   : The exception service routine for SVC.
@@ -65,14 +29,14 @@ SVC_Handler
                                                     ; Extract stack frame starting address.
     TST       LR, #4                                ; Test the second bit of EXC_RETURN.
     ITE       EQ                                    ; If-Then-Else block.
-    MRSEQ     R0, MSP                               ; If bit 2 clear, Load the current MSP value.
-    MRSNE     R0, PSP                               ; If bit 2 set, Load the current PSP value.
+    MRSEQ     R1, MSP                               ; If bit 2 clear, Load the current MSP value.
+    MRSNE     R1, PSP                               ; If bit 2 set, Load the current PSP value.
 
-    LDR       R0, [R0, #24]                         ; Load the PC value from stack frame.
+    LDR       R0, [R1, #24]                         ; Load the PC value from stack frame.
     LDRB      R0, [R0, #-2]                         ; Extract the SVC number from PC.
 
     CMP       R0, #0                                ; Check if the SVC number is 0 [Task Transition Request].
-    BNE       SVC_END                               ; If the SVC number is not 0, exit.
+    BNE       SVC_TICKLESS_IDLE                     ; If the SVC number is not 0, check the next request.
 
     PUSH      {LR}                                  ; Save the current return address before branching.
     BL        MamOS_forceTaskTransition             ; Call a C function for task switching.
@@ -80,4 +44,34 @@ SVC_Handler
 
     BX        LR                                    ; Return from exception.
 
-SVC_END                                             ; End of SVC handler.
\ No newline at end of file
+SVC_TICKLESS_IDLE                                   ; Check the tickless idle request.
+    CMP       R0, #1                                ; Check if the SVC number is 1 [Tickless Idle Request].
+    BNE       SVC_TASK_RELEASE                      ; If the SVC number is not 1, check the next request.
+
+    PUSH      {LR}                                  ; Save the current return address before branching.
+    BL        MamOS_enterTicklessIdle               ; Call a C function for tickless idle.
+    POP       {LR}                                  ; Restore saved return address.
+
+    BX        LR                                    ; Return from exception.
+
+SVC_TASK_RELEASE                                    ; Check the task release request.
+    CMP       R0, #2                                ; Check if the SVC number is 2 [Task Release Request].
+    BNE       SVC_KERNEL_CALL                       ; If the SVC number is not 2, check the next request.
+
+    PUSH      {LR}                                  ; Save the current return address before branching.
+    BL        MamOS_forceTaskTransitionUntil        ; Call a C function for task switching until release.
+    POP       {LR}                                  ; Restore saved return address.
+
+    BX        LR                                    ; Return from exception.
+
+SVC_KERNEL_CALL                                     ; Check the kernel call request.
+    CMP       R0, #3                                ; Check if the SVC number is 3 [Kernel Call Request].
+    BNE       SVC_END                               ; If the SVC number is not 3, exit.
+
+    MOV       R0, R1                                ; Pass the stack frame [the call arguments and result].
+    PUSH      {LR}                                  ; Save the current return address before branching.
+    BL        MamOS_executeKernelCall               ; Call a C function for kernel calls.
+    POP       {LR}                                  ; Restore saved return address.
+
+SVC_END                                             ; End of SVC handler.
+    BX        LR                                    ; Return from exception.
\ No newline at end of file
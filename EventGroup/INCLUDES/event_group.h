@@ -0,0 +1,82 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Event Group
+File Name    : event_group.h
+Date Created : Oct 17, 2026
+Description  : Interface file for the MamOS Event Group module.
+=======================================================================================================================
+*/
+
+
+#ifndef MAMOS_EVENTGROUP_INCLUDES_EVENT_GROUP_H_
+#define MAMOS_EVENTGROUP_INCLUDES_EVENT_GROUP_H_
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createEventGroup
+ * [Description]   : Creates a new event group of 32 event bits in the MamOS [all the bits are initially cleared].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the handle to the created event group [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_eventGroupHandle MamOS_createEventGroup(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setEventBits
+ * [Description]   : Sets specific bits in a specific event group, Then releases all the satisfied waiting tasks in
+ *                   a single pass and switches to the highest priority of them if it precedes the current task.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToSet>        -> Indicates to the bits to be set.
+ * [return]        : The function returns the event bits after releasing the waiting tasks.
+ ====================================================================================================================*/
+uint32 MamOS_setEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToSet);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setEventBitsFromISR
+ * [Description]   : Sets specific bits in a specific event group from an interrupt, The walk over the waiting tasks
+ *                   is deferred to the PendSV exception [the lowest priority], So the interrupt stays short and the
+ *                   released tasks are switched to by the same PendSV.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToSet>        -> Indicates to the bits to be set.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_setEventBitsFromISR(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToSet);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_clearEventBits
+ * [Description]   : Clears specific bits in a specific event group.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToClear>      -> Indicates to the bits to be cleared.
+ * [return]        : The function returns the event bits before clearing.
+ ====================================================================================================================*/
+uint32 MamOS_clearEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToClear);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitEventBits
+ * [Description]   : Waits for any or all of specific bits in a specific event group to be set, The task is blocked
+ *                   until the condition is satisfied or the timeout expires.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToWait>       -> Indicates to the bits to be waited for [non-zero].
+ *                   <a_waitMode>         -> Indicates to the wait mode: - MAMOS_EVENT_WAIT_ANY.
+ *                                                                       - MAMOS_EVENT_WAIT_ALL.
+ *                   <a_clearOnExit>      -> Indicates whether the waited bits are cleared when satisfied or not.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns the event bits when the condition is satisfied [before clearing], Or
+ *                   the current event bits if the timeout expired.
+ ====================================================================================================================*/
+uint32 MamOS_waitEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToWait, uint8 a_waitMode, uint8 a_clearOnExit, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_processDeferredEventBits
+ * [Description]   : Processes the event bits set from interrupts, Releasing the satisfied waiting tasks [called by
+ *                   the PendSV exception before the context switch].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_processDeferredEventBits(void);
+
+#endif /* MAMOS_EVENTGROUP_INCLUDES_EVENT_GROUP_H_ */
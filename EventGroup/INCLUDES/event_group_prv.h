@@ -0,0 +1,75 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Event Group
+File Name    : event_group_prv.h
+Date Created : Oct 17, 2026
+Description  : Private file for the MamOS Event Group module.
+=======================================================================================================================
+*/
+
+
+#ifndef MAMOS_EVENTGROUP_INCLUDES_EVENT_GROUP_PRV_H_
+#define MAMOS_EVENTGROUP_INCLUDES_EVENT_GROUP_PRV_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+typedef struct
+{
+    MamOS_eventGroupHandle ptr2eventGroup;                  /* The required event group.                             */
+    uint32 eventBits;                                       /* The bits to be set, cleared, or waited for.           */
+    uint8 waitMode;                                         /* Wait for any or all of the waited bits.               */
+    uint8 clearOnExit;                                      /* Clear the waited bits when satisfied.                 */
+    uint32 resultBits;                                      /* The event bits when the wait ended.                   */
+    uint32 timeoutTicks;                                    /* Maximum waiting time [in ticks].                      */
+}MamOS_eventRequestType;
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Checks if the event bits satisfy the waited bits in a specific wait mode. */
+#define MAMOS_EVENT_IS_SATISFIED(BITS, WAIT_BITS, MODE)  (((MODE) == MAMOS_EVENT_WAIT_ALL) ? (((BITS) & (WAIT_BITS)) == (WAIT_BITS)) : (((BITS) & (WAIT_BITS)) != 0))
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_releaseEventWaiters
+ * [Description]   : Sets specific bits in a specific event group, Then releases all the satisfied waiting tasks in
+ *                   a single pass [called inside a critical section].
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToSet>        -> Indicates to the bits to be set.
+ * [return]        : The function returns TRUE if a released task precedes the task going to run next.
+ ====================================================================================================================*/
+static uint8 MamOS_releaseEventWaiters(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToSet);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setEventBitsCall
+ * [Description]   : Handles setting bits in a specific event group [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the set request.
+ * [return]        : The function returns the event bits after releasing the waiting tasks.
+ ====================================================================================================================*/
+static uint32 MamOS_setEventBitsCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_clearEventBitsCall
+ * [Description]   : Handles clearing bits in a specific event group [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the clear request.
+ * [return]        : The function returns the event bits before clearing.
+ ====================================================================================================================*/
+static uint32 MamOS_clearEventBitsCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitEventBitsCall
+ * [Description]   : Handles waiting for bits in a specific event group [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the wait request.
+ * [return]        : The function returns TRUE if the wait ended [satisfied or no waiting], Or pending if the task
+ *                   is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_waitEventBitsCall(void* a_ptr2argument);
+
+#endif /* MAMOS_EVENTGROUP_INCLUDES_EVENT_GROUP_PRV_H_ */
@@ -0,0 +1,318 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Event Group
+File Name    : event_group.c
+Date Created : Oct 17, 2026
+Description  : Source file for the MamOS Event Group module.
+=======================================================================================================================
+*/
+
+
+/*=====================================================================================================================
+ * [Details]     : This module hosts the event groups of the MamOS, Each group holds 32 event bits that tasks wait
+ *                 for in any or all combinations with an optional timeout. Setting bits releases all the satisfied
+ *                 waiting tasks in a single pass with a single context switch, and the bits set from interrupts
+ *                 are processed later by the PendSV exception, So the waiting tasks are never walked inside
+ *                 an interrupt.
+ ====================================================================================================================*/
+
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+#include "../../Others/std_types.h"
+#include "../../Others/kernel_defs.h"
+#include "../../System/INCLUDES/system.h"
+#include "../../Queue/INCLUDES/queue.h"
+#include "../../Scheduler/INCLUDES/scheduler.h"
+#include "../../Core/INCLUDES/core.h"
+#include "../INCLUDES/event_group_prv.h"
+#include "../INCLUDES/event_group.h"
+
+/*=====================================================================================================================
+                                           < Global Variables >
+=====================================================================================================================*/
+
+/* Array of event groups that available in the system. */
+volatile MamOS_eventGroupType G_eventGroupHeap[MAMOS_MAX_NUM_OF_EVENT_GROUPS] = {0};
+
+/* Extern the Kernel Control Panel. */
+extern MamOS_kernelControlPanelType G_kernelControlPanel;
+
+/*=====================================================================================================================
+                                          < Functions Definitions >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createEventGroup
+ * [Description]   : Creates a new event group of 32 event bits in the MamOS [all the bits are initially cleared].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the handle to the created event group [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_eventGroupHandle MamOS_createEventGroup(void)
+{
+    MamOS_eventGroupHandle LOC_createdEventGroupHandle = NULL_PTR;
+
+    if(G_kernelControlPanel.eventGroupCounter < MAMOS_MAX_NUM_OF_EVENT_GROUPS)
+    {
+        /* Get the handle of the created event group and increment the event group counter. */
+        LOC_createdEventGroupHandle = &G_eventGroupHeap[G_kernelControlPanel.eventGroupCounter];
+        G_kernelControlPanel.eventGroupCounter++;
+
+        /* Initialize the new event group. */
+        LOC_createdEventGroupHandle->eventBits = 0;
+        LOC_createdEventGroupHandle->deferredBits = 0;
+        LOC_createdEventGroupHandle->waitingQueue.queueSize = 0;
+        LOC_createdEventGroupHandle->waitingQueue.ptr2headTask = NULL_PTR;
+        LOC_createdEventGroupHandle->waitingQueue.ptr2rearTask = NULL_PTR;
+    }
+
+    else
+    {
+        /* Invalid Operation. */
+    }
+
+    return LOC_createdEventGroupHandle;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setEventBits
+ * [Description]   : Sets specific bits in a specific event group, Then releases all the satisfied waiting tasks in
+ *                   a single pass and switches to the highest priority of them if it precedes the current task.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToSet>        -> Indicates to the bits to be set.
+ * [return]        : The function returns the event bits after releasing the waiting tasks.
+ ====================================================================================================================*/
+uint32 MamOS_setEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToSet)
+{
+    MamOS_eventRequestType LOC_request = {0};
+
+    LOC_request.ptr2eventGroup = a_ptr2eventGroup;
+    LOC_request.eventBits = a_bitsToSet;
+
+    return MamOS_kernelCall(MamOS_setEventBitsCall, &LOC_request);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setEventBitsFromISR
+ * [Description]   : Sets specific bits in a specific event group from an interrupt, The walk over the waiting tasks
+ *                   is deferred to the PendSV exception [the lowest priority], So the interrupt stays short and the
+ *                   released tasks are switched to by the same PendSV.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToSet>        -> Indicates to the bits to be set.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_setEventBitsFromISR(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToSet)
+{
+    MamOS_enterCritical();
+
+    a_ptr2eventGroup->deferredBits |= a_bitsToSet;
+    G_kernelControlPanel.deferredEventsFlag = TRUE;
+
+    MamOS_exitCritical();
+
+    SYSTEM_setExceptionPending(SYSTEM_PENDSV_EXCEPTION);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_clearEventBits
+ * [Description]   : Clears specific bits in a specific event group.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToClear>      -> Indicates to the bits to be cleared.
+ * [return]        : The function returns the event bits before clearing.
+ ====================================================================================================================*/
+uint32 MamOS_clearEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToClear)
+{
+    MamOS_eventRequestType LOC_request = {0};
+
+    LOC_request.ptr2eventGroup = a_ptr2eventGroup;
+    LOC_request.eventBits = a_bitsToClear;
+
+    return MamOS_kernelCall(MamOS_clearEventBitsCall, &LOC_request);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitEventBits
+ * [Description]   : Waits for any or all of specific bits in a specific event group to be set, The task is blocked
+ *                   until the condition is satisfied or the timeout expires.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToWait>       -> Indicates to the bits to be waited for [non-zero].
+ *                   <a_waitMode>         -> Indicates to the wait mode: - MAMOS_EVENT_WAIT_ANY.
+ *                                                                       - MAMOS_EVENT_WAIT_ALL.
+ *                   <a_clearOnExit>      -> Indicates whether the waited bits are cleared when satisfied or not.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns the event bits when the condition is satisfied [before clearing], Or
+ *                   the current event bits if the timeout expired.
+ ====================================================================================================================*/
+uint32 MamOS_waitEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToWait, uint8 a_waitMode, uint8 a_clearOnExit, uint32 a_timeoutTicks)
+{
+    MamOS_eventRequestType LOC_request = {0};
+
+    LOC_request.ptr2eventGroup = a_ptr2eventGroup;
+    LOC_request.eventBits = a_bitsToWait;
+    LOC_request.waitMode = a_waitMode;
+    LOC_request.clearOnExit = a_clearOnExit;
+    LOC_request.timeoutTicks = a_timeoutTicks;
+
+    /* A released task gets its result bits from the setter, A timed out task reads the current event bits. */
+    if((MamOS_kernelCall(MamOS_waitEventBitsCall, &LOC_request) == MAMOS_WAIT_RESULT_PENDING) &&
+       (G_kernelControlPanel.ptr2activeTask->waitResult == FALSE))
+    {
+        LOC_request.resultBits = a_ptr2eventGroup->eventBits;
+    }
+
+    return LOC_request.resultBits;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_processDeferredEventBits
+ * [Description]   : Processes the event bits set from interrupts, Releasing the satisfied waiting tasks [called by
+ *                   the PendSV exception before the context switch].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_processDeferredEventBits(void)
+{
+    uint8 LOC_precedingFlag = FALSE;
+
+    MamOS_enterCritical();
+
+    G_kernelControlPanel.deferredEventsFlag = FALSE;
+
+    for(uint8 iterator = 0; iterator < G_kernelControlPanel.eventGroupCounter; iterator++)
+    {
+        if(G_eventGroupHeap[iterator].deferredBits != 0)
+        {
+            uint32 LOC_deferredBits = G_eventGroupHeap[iterator].deferredBits;
+
+            G_eventGroupHeap[iterator].deferredBits = 0;
+            LOC_precedingFlag |= MamOS_releaseEventWaiters(&G_eventGroupHeap[iterator], LOC_deferredBits);
+        }
+    }
+
+    /* Select the highest priority released task as the standby task, So this PendSV switches to it directly. */
+    MamOS_yieldFromPendSV(LOC_precedingFlag);
+
+    MamOS_exitCritical();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_releaseEventWaiters
+ * [Description]   : Sets specific bits in a specific event group, Then releases all the satisfied waiting tasks in
+ *                   a single pass [called inside a critical section].
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToSet>        -> Indicates to the bits to be set.
+ * [return]        : The function returns TRUE if a released task precedes the task going to run next.
+ ====================================================================================================================*/
+static uint8 MamOS_releaseEventWaiters(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToSet)
+{
+    uint8 LOC_precedingFlag = FALSE;
+    uint32 LOC_bitsToClear = 0;
+    MamOS_taskControlBlockType* LOC_ptr2currentTask = a_ptr2eventGroup->waitingQueue.ptr2headTask;
+
+    a_ptr2eventGroup->eventBits |= a_bitsToSet;
+
+    while(LOC_ptr2currentTask != NULL_PTR)
+    {
+        MamOS_taskControlBlockType* LOC_ptr2nextTask = LOC_ptr2currentTask->ptr2nextWaitingTask;
+        MamOS_eventRequestType* LOC_ptr2request = LOC_ptr2currentTask->ptr2waitingData;
+
+        /* All the waiting tasks are checked against the same bits, The bits are cleared after the pass. */
+        if(MAMOS_EVENT_IS_SATISFIED(a_ptr2eventGroup->eventBits, LOC_ptr2request->eventBits, LOC_ptr2request->waitMode))
+        {
+            LOC_ptr2request->resultBits = a_ptr2eventGroup->eventBits;
+
+            if(LOC_ptr2request->clearOnExit == TRUE)
+            {
+                LOC_bitsToClear |= LOC_ptr2request->eventBits;
+            }
+
+            MamOS_wakeFromWaitingQueue(LOC_ptr2currentTask);
+
+            if(MamOS_isTaskPreceding(LOC_ptr2currentTask, G_kernelControlPanel.ptr2standbyTask) == TRUE)
+            {
+                LOC_precedingFlag = TRUE;
+            }
+        }
+
+        LOC_ptr2currentTask = LOC_ptr2nextTask;
+    }
+
+    a_ptr2eventGroup->eventBits &= ~LOC_bitsToClear;
+
+    return LOC_precedingFlag;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setEventBitsCall
+ * [Description]   : Handles setting bits in a specific event group [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the set request.
+ * [return]        : The function returns the event bits after releasing the waiting tasks.
+ ====================================================================================================================*/
+static uint32 MamOS_setEventBitsCall(void* a_ptr2argument)
+{
+    MamOS_eventRequestType* LOC_ptr2request = a_ptr2argument;
+
+    /* The released tasks are only readied in the pass, So a single switch is requested at the end. */
+    MamOS_yieldFromISR(MamOS_releaseEventWaiters(LOC_ptr2request->ptr2eventGroup, LOC_ptr2request->eventBits));
+
+    return LOC_ptr2request->ptr2eventGroup->eventBits;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_clearEventBitsCall
+ * [Description]   : Handles clearing bits in a specific event group [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the clear request.
+ * [return]        : The function returns the event bits before clearing.
+ ====================================================================================================================*/
+static uint32 MamOS_clearEventBitsCall(void* a_ptr2argument)
+{
+    MamOS_eventRequestType* LOC_ptr2request = a_ptr2argument;
+    uint32 LOC_eventBits = LOC_ptr2request->ptr2eventGroup->eventBits;
+
+    LOC_ptr2request->ptr2eventGroup->eventBits = LOC_eventBits & ~(LOC_ptr2request->eventBits);
+
+    return LOC_eventBits;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitEventBitsCall
+ * [Description]   : Handles waiting for bits in a specific event group [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the wait request.
+ * [return]        : The function returns TRUE if the wait ended [satisfied or no waiting], Or pending if the task
+ *                   is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_waitEventBitsCall(void* a_ptr2argument)
+{
+    uint32 LOC_result = TRUE;
+    MamOS_eventRequestType* LOC_ptr2request = a_ptr2argument;
+    MamOS_eventGroupHandle LOC_ptr2eventGroup = LOC_ptr2request->ptr2eventGroup;
+
+    LOC_ptr2request->resultBits = LOC_ptr2eventGroup->eventBits;
+
+    if(MAMOS_EVENT_IS_SATISFIED(LOC_ptr2eventGroup->eventBits, LOC_ptr2request->eventBits, LOC_ptr2request->waitMode))
+    {
+        if(LOC_ptr2request->clearOnExit == TRUE)
+        {
+            LOC_ptr2eventGroup->eventBits &= ~(LOC_ptr2request->eventBits);
+        }
+    }
+
+    else if(LOC_ptr2request->timeoutTicks == 0)
+    {
+        /* Invalid Operation [the condition is not satisfied and the task doesn't wait]. */
+    }
+
+    else
+    {
+        /* Block the task with its request, So the setter checks its condition and stores its result bits. */
+        G_kernelControlPanel.ptr2activeTask->ptr2waitingData = LOC_ptr2request;
+        MamOS_addToWaitingQueue(&LOC_ptr2eventGroup->waitingQueue, G_kernelControlPanel.ptr2activeTask, LOC_ptr2request->timeoutTicks);
+        MamOS_forceTaskTransition();
+        LOC_result = MAMOS_WAIT_RESULT_PENDING;
+    }
+
+    return LOC_result;
+}
@@ -17,11 +17,35 @@ Description  : Interface file for all MamOS public APIs.
 
 #include "Others/std_types.h"
 
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+#define MAMOS_TASK_FPU_FREE                   (0U)                    /* The task never uses the FPU [no context].   */
+#define MAMOS_TASK_FPU_USED                   (1U)                    /* The task may use the FPU.                   */
+#define MAMOS_WAIT_FOREVER                    (0XFFFFFFFFUL)          /* Waiting timeout value to wait forever.      */
+#define MAMOS_BINARY_SEMAPHORE                (1U)                    /* Maximum count of a binary semaphore.        */
+#define MAMOS_NOTIFY_SET_BITS                 (0U)                    /* Notify by setting bits in the value.        */
+#define MAMOS_NOTIFY_INCREMENT                (1U)                    /* Notify by incrementing the value.           */
+#define MAMOS_NOTIFY_OVERWRITE                (2U)                    /* Notify by overwriting the value.            */
+#define MAMOS_EVENT_WAIT_ANY                  (0U)                    /* Wait until any of the waited bits is set.   */
+#define MAMOS_EVENT_WAIT_ALL                  (1U)                    /* Wait until all of the waited bits are set.  */
+#define MAMOS_NO_PRIORITY_CEILING             (0XFFU)                 /* Mutex with priority inheritance instead.    */
+#define MAMOS_REGION_NO_ACCESS                (0U)                    /* The task can not access the memory region.  */
+#define MAMOS_REGION_READ_ONLY                (1U)                    /* The task can only read the memory region.   */
+#define MAMOS_REGION_READ_WRITE               (2U)                    /* The task can read and write the region.     */
+
 /*=====================================================================================================================
                                        < User-defined Data Types >
 =====================================================================================================================*/
 
+typedef struct TaskControlBlock* MamOS_taskHandle;
 typedef struct mutex* MamOS_mutexHandle;
+typedef struct ringBuffer* MamOS_ringBufferHandle;
+typedef struct messageQueue* MamOS_messageQueueHandle;
+typedef struct semaphore* MamOS_semaphoreHandle;
+typedef struct eventGroup* MamOS_eventGroupHandle;
+typedef struct memoryPool* MamOS_memoryPoolHandle;
 
 /*=====================================================================================================================
                                       < Public Functions Prototypes >
@@ -43,6 +67,44 @@ void MamOS_init(void);
  ====================================================================================================================*/
 void MamOS_launch(void);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTickCount
+ * [Description]   : Gets the number of system ticks since the kernel was launched.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the current system tick count.
+ ====================================================================================================================*/
+uint64 MamOS_getTickCount(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMaxCriticalCycles
+ * [Description]   : Gets the longest masked window of the kernel critical sections since the last reading, Then
+ *                   resets it [so the window of a specific kernel API can be measured between two readings].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the longest critical section in CPU cycles [zero if not profiled].
+ ====================================================================================================================*/
+uint32 MamOS_getMaxCriticalCycles(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_stackOverflowHandler
+ * [Description]   : Handles a stack overflow detected on a context switch [the lowest word of the switched out
+ *                   task stack lost its paint], It halts the system by default, And it's a weak function, So the
+ *                   application can override it to report the task or to reset the system.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the task that overflowed its stack.
+ * [return]        : The function never returns.
+ ====================================================================================================================*/
+void MamOS_stackOverflowHandler(MamOS_taskHandle a_ptr2task);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_memoryFaultHandler
+ * [Description]   : Handles a memory access denied by the MPU [a stack overflow into the stack guard or an access
+ *                   to a protected data region], It halts the system by default, And it's a weak function, So the
+ *                   application can override it to report the task or to reset the system.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the task that caused the fault.
+ *                   <a_faultAddress>       -> Indicates to the denied address [or zero if it's not known].
+ * [return]        : The function never returns.
+ ====================================================================================================================*/
+void MamOS_memoryFaultHandler(MamOS_taskHandle a_ptr2task, uint32 a_faultAddress);
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_createTask
  * [Description]   : Creates a new task, sets up its stack, and adds it to the ready queue.
@@ -50,9 +112,39 @@ void MamOS_launch(void);
  *                   <a_taskStackSize>      -> Indicates to the task stack size [in words].
  *                   <a_priority>           -> Indicates to the task priority [0 ~ 255].
  *                   <a_periodicity>        -> Indicates to the periodic task periodicity [in system ticks].
+ *                   <a_fpuUsage>           -> Indicates whether the task uses the FPU or not, The FPU context is
+ *                                             added to the stack size of the FPU tasks only.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_createTask(void (*a_ptr2taskEntryPoint)(void), uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity, uint8 a_fpuUsage);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createStaticTask
+ * [Description]   : Creates a new task on a stack supplied by the user instead of the kernel stack pool, sets up
+ *                   its stack, and adds it to the ready queue.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Pointer to the task entry point.
+ *                   <a_ptr2taskStack>      -> Pointer to the task stack buffer [8-byte aligned, Or 32-byte aligned
+ *                                             if the MPU stack guards are enabled].
+ *                   <a_taskStackSize>      -> Indicates to the task stack buffer size [in words], It includes the
+ *                                             FPU context of the FPU tasks [and the stack guard words at the
+ *                                             bottom of the buffer if the MPU stack guards are enabled].
+ *                   <a_priority>           -> Indicates to the task priority [0 ~ 255].
+ *                   <a_periodicity>        -> Indicates to the periodic task periodicity [in system ticks].
+ *                   <a_fpuUsage>           -> Indicates whether the task uses the FPU or not.
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_createTask(void (*a_ptr2taskEntryPoint)(void), uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity);
+void MamOS_createStaticTask(void (*a_ptr2taskEntryPoint)(void), uint32* a_ptr2taskStack, uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity, uint8 a_fpuUsage);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_deleteTask
+ * [Description]   : Deletes a specific task, It's removed from the queue that holds it, Its mutexes are handed
+ *                   over to their waiting tasks, Its stack returns to the kernel stack pool [if it's taken from it],
+ *                   And its task control block is reused by the next created task. A task that deletes itself is
+ *                   switched out at once and never returns [the idle task can't be deleted].
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_deleteTask(MamOS_taskHandle a_ptr2task);
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_suspendTask
@@ -70,13 +162,47 @@ void MamOS_suspendTask(void (*a_ptr2taskEntryPoint)(void));
  ====================================================================================================================*/
 void MamOS_resumeTask(void (*a_ptr2taskEntryPoint)(void));
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_resumeTaskFromISR
+ * [Description]   : Resumes a suspended task from an interrupt context, The context switch is left to
+ *                   MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2taskEntryPoint>        -> Indicates to the required task to be resumed.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the resumed
+ *                                                    task precedes the task going to run next [never cleared].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_resumeTaskFromISR(void (*a_ptr2taskEntryPoint)(void), uint8* a_ptr2higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_yieldFromISR
+ * [Description]   : Requests a context switch at the end of an interrupt if a FromISR call woke up a task that
+ *                   precedes the task going to run next, The requests of the nested interrupts are coalesced
+ *                   into a single PendSV that runs after the last interrupt exits.
+ * [Arguments]     : <a_higherPriorityTaskWoken> -> Indicates whether a higher priority task was woken or not
+ *                                                  [the result collected from the FromISR calls].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_yieldFromISR(uint8 a_higherPriorityTaskWoken);
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_taskDelay
  * [Description]   : Delays the current task for a specified number of ticks.
- * [Arguments]     : <a_delayTicks> -> Indicates to the number of ticks to delay the task.
+ * [Arguments]     : <a_delayTicks> -> Indicates to the number of ticks to delay the task [up to 2^31 - 1].
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_taskDelay(uint16 a_delayTicks);
+void MamOS_taskDelay(uint32 a_delayTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_taskDelayUntil
+ * [Description]   : Delays the current task until a specific number of ticks after its last wake-up tick,
+ *                   So a periodic task is released at a fixed rate regardless of its execution time.
+ * [Arguments]     : <a_ptr2lastWakeTick> -> Pointer to the last wake-up tick held by the task [initialized with
+ *                                           MamOS_getTickCount, So it's 64-bit too], It's updated with the next
+ *                                           wake-up tick.
+ *                   <a_periodTicks>      -> Indicates to the number of ticks between the wake-up ticks.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_taskDelayUntil(uint64* a_ptr2lastWakeTick, uint32 a_periodTicks);
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_taskYield
@@ -87,12 +213,101 @@ void MamOS_taskDelay(uint16 a_delayTicks);
 void MamOS_taskYield(void);
 
 /*=====================================================================================================================
- * [Function Name] : MamOS_createMutex
- * [Description]   : reates a new mutex in the MamOS.
+ * [Function Name] : MamOS_taskYieldToPeers
+ * [Description]   : Gives up the rest of the current time slice to the ready tasks with the same priority,
+ *                   The current task stays ready and runs again after its peers [or immediately if none].
  * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_taskYieldToPeers(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTaskHandle
+ * [Description]   : Gets the handle of a specific task, So it can be notified directly without searching for it.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Indicates to the required task.
+ * [return]        : The function returns the handle to the required task [or Null Pointer if it's not found].
+ ====================================================================================================================*/
+MamOS_taskHandle MamOS_getTaskHandle(void (*a_ptr2taskEntryPoint)(void));
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTaskStackHighWater
+ * [Description]   : Gets the minimum number of free words that a specific task ever left in its stack, The whole
+ *                   stack is painted at creation, So the words at the bottom of the stack that still hold the paint
+ *                   were never used.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ * [return]        : The function returns the minimum remaining free words of the task stack.
+ ====================================================================================================================*/
+uint32 MamOS_getTaskStackHighWater(MamOS_taskHandle a_ptr2task);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setTaskMemoryRegion
+ * [Description]   : Sets one of the MPU data regions of a specific task, So the task access to the region is
+ *                   limited [read only or no access] while the task is running, Any denied access faults at once.
+ *                   The regions take effect only if MAMOS_MPU_PROTECTION is enabled.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ *                   <a_regionIndex>        -> Indicates to the data region index [0 ~ 1].
+ *                   <a_ptr2regionBase>     -> Pointer to the region base [aligned to the region size].
+ *                   <a_regionSize>         -> Indicates to the region size [in bytes, a power of 2 from 32 bytes],
+ *                                             Or zero to disable the data region.
+ *                   <a_access>             -> Indicates to the task access: - MAMOS_REGION_NO_ACCESS.
+ *                                                                          - MAMOS_REGION_READ_ONLY.
+ *                                                                          - MAMOS_REGION_READ_WRITE.
+ * [return]        : The function returns TRUE if the region is set, FALSE if the region is invalid.
+ ====================================================================================================================*/
+uint8 MamOS_setTaskMemoryRegion(MamOS_taskHandle a_ptr2task, uint8 a_regionIndex, void* a_ptr2regionBase, uint32 a_regionSize, uint8 a_access);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_notifyTask
+ * [Description]   : Sends a direct notification to a specific task, Then wakes it up if it's waiting for a
+ *                   notification and switches to it if it precedes the current task [no queue is searched].
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the task to be notified.
+ *                   <a_value>              -> Indicates to the bits to be set or the value to be written.
+ *                   <a_action>             -> Indicates to the notify action: - MAMOS_NOTIFY_SET_BITS.
+ *                                                                            - MAMOS_NOTIFY_INCREMENT.
+ *                                                                            - MAMOS_NOTIFY_OVERWRITE.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_notifyTask(MamOS_taskHandle a_ptr2task, uint32 a_value, uint8 a_action);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_notifyTaskFromISR
+ * [Description]   : Sends a direct notification to a specific task from an interrupt, The context switch to the
+ *                   woken task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the task to be notified.
+ *                   <a_value>              -> Indicates to the bits to be set or the value to be written.
+ *                   <a_action>             -> Indicates to the notify action [set bits, increment, or overwrite].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_notifyTaskFromISR(MamOS_taskHandle a_ptr2task, uint32 a_value, uint8 a_action, uint8* a_ptr2higherPriorityTaskWoken);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitForNotification
+ * [Description]   : Waits for a direct notification to the current task, The task is blocked until it's notified
+ *                   or the timeout expires [a notification sent before the wait is received immediately].
+ * [Arguments]     : <a_clearOnEntryMask>   -> Indicates to the value bits to be cleared before waiting [ignored
+ *                                             if a notification is already pending].
+ *                   <a_clearOnExitMask>    -> Indicates to the value bits to be cleared after receiving.
+ *                   <a_ptr2value>          -> Pointer to a variable to store the received value [or Null Pointer].
+ *                   <a_timeoutTicks>       -> Indicates to the maximum waiting time [in ticks], Zero to never
+ *                                             wait, Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if a notification is received, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_waitForNotification(uint32 a_clearOnEntryMask, uint32 a_clearOnExitMask, uint32* a_ptr2value, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createMutex
+ * [Description]   : Creates a new mutex in the MamOS, The mutex either raises its owner to a ceiling priority as
+ *                   soon as it's acquired [immediate priority ceiling], Or uses priority inheritance.
+ * [Arguments]     : <a_ceilingPriority> -> Indicates to the priority of the highest priority task that acquires
+ *                                          the mutex, Or MAMOS_NO_PRIORITY_CEILING for priority inheritance.
  * [return]        : The function returns the handle to the created mutex [or Null Pointer if creation fails].
  ====================================================================================================================*/
-MamOS_mutexHandle MamOS_createMutex(void);
+MamOS_mutexHandle MamOS_createMutex(uint8 a_ceilingPriority);
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_acquireMutex
@@ -110,4 +325,330 @@ void MamOS_acquireMutex(MamOS_mutexHandle a_ptr2mutex);
  ====================================================================================================================*/
 void MamOS_releaseMutex(MamOS_mutexHandle a_ptr2mutex);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createRingBuffer
+ * [Description]   : Creates a new single-producer/single-consumer ring buffer in the MamOS.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the ring buffer [supplied by the user].
+ *                   <a_capacity>         -> Indicates to the storage buffer size [in bytes, a power of two].
+ * [return]        : The function returns the handle to the created ring buffer [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_ringBufferHandle MamOS_createRingBuffer(uint8* a_ptr2storage, uint32 a_capacity);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_writeRingBuffer
+ * [Description]   : Writes data to a specific ring buffer from the producer task without blocking, Then wakes the
+ *                   consumer task up if it's waiting for data [wait-free unless the consumer is waiting].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to the data to be written.
+ *                   <a_length>           -> Indicates to the data length [in bytes].
+ * [return]        : The function returns the number of written bytes [less than the length if the ring is full].
+ ====================================================================================================================*/
+uint32 MamOS_writeRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, const uint8* a_ptr2data, uint32 a_length);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_writeRingBufferFromISR
+ * [Description]   : Writes data to a specific ring buffer from the producer interrupt without blocking, The context
+ *                   switch to the woken consumer task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to the data to be written.
+ *                   <a_length>           -> Indicates to the data length [in bytes].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    consumer task precedes the task going to run next.
+ * [return]        : The function returns the number of written bytes [less than the length if the ring is full].
+ ====================================================================================================================*/
+uint32 MamOS_writeRingBufferFromISR(MamOS_ringBufferHandle a_ptr2ringBuffer, const uint8* a_ptr2data, uint32 a_length, uint8* a_ptr2higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_readRingBuffer
+ * [Description]   : Reads the available data from a specific ring buffer by the consumer task, The task is blocked
+ *                   only while the ring is empty.
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to a buffer to store the read data.
+ *                   <a_length>           -> Indicates to the maximum data length to be read [in bytes].
+ * [return]        : The function returns the number of read bytes [at least one byte if the length is not zero].
+ ====================================================================================================================*/
+uint32 MamOS_readRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, uint8* a_ptr2data, uint32 a_length);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createMessageQueue
+ * [Description]   : Creates a new message queue of fixed-size items in the MamOS.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the message queue [supplied by the
+ *                                           user, at least item size times capacity bytes].
+ *                   <a_itemSize>         -> Indicates to the size of a single item [in bytes].
+ *                   <a_capacity>         -> Indicates to the maximum number of items in the message queue.
+ * [return]        : The function returns the handle to the created message queue [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_messageQueueHandle MamOS_createMessageQueue(uint8* a_ptr2storage, uint16 a_itemSize, uint16 a_capacity);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_sendToMessageQueue
+ * [Description]   : Sends an item to a specific message queue, The item is copied directly to the highest priority
+ *                   waiting receiver [if any], Otherwise it's stored in the message queue. The task is blocked
+ *                   while the message queue is full until a slot is freed or the timeout expires.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to the item to be sent.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_sendToMessageQueue(MamOS_messageQueueHandle a_ptr2messageQueue, const void* a_ptr2item, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_sendToMessageQueueFromISR
+ * [Description]   : Sends an item to a specific message queue from an interrupt without blocking, The context
+ *                   switch to the woken receiver task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to the item to be sent.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    receiver task precedes the task going to run next.
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the message queue is full.
+ ====================================================================================================================*/
+uint8 MamOS_sendToMessageQueueFromISR(MamOS_messageQueueHandle a_ptr2messageQueue, const void* a_ptr2item, uint8* a_ptr2higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_receiveFromMessageQueue
+ * [Description]   : Receives the oldest item from a specific message queue, The task is blocked while the message
+ *                   queue is empty until an item is sent or the timeout expires.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to a buffer to store the received item.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if an item is received, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_receiveFromMessageQueue(MamOS_messageQueueHandle a_ptr2messageQueue, void* a_ptr2item, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createSemaphore
+ * [Description]   : Creates a new counting semaphore in the MamOS [a maximum count of one gives a binary semaphore].
+ * [Arguments]     : <a_initialCount>     -> Indicates to the initial number of available tokens.
+ *                   <a_maxCount>         -> Indicates to the maximum number of tokens [non-zero].
+ * [return]        : The function returns the handle to the created semaphore [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_semaphoreHandle MamOS_createSemaphore(uint32 a_initialCount, uint32 a_maxCount);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeSemaphore
+ * [Description]   : Takes a token from a specific semaphore, The task is blocked while no token is available until
+ *                   a token is given or the timeout expires.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if a token is taken, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_takeSemaphore(MamOS_semaphoreHandle a_ptr2semaphore, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_giveSemaphore
+ * [Description]   : Gives a token to a specific semaphore, The token is handed over directly to the highest
+ *                   priority waiting task [if any] and the CPU is switched to it if it precedes the current task.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+uint8 MamOS_giveSemaphore(MamOS_semaphoreHandle a_ptr2semaphore);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_giveSemaphoreFromISR
+ * [Description]   : Gives a token to a specific semaphore from an interrupt, The context switch to the woken task
+ *                   is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+uint8 MamOS_giveSemaphoreFromISR(MamOS_semaphoreHandle a_ptr2semaphore, uint8* a_ptr2higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createEventGroup
+ * [Description]   : Creates a new event group of 32 event bits in the MamOS [all the bits are initially cleared].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the handle to the created event group [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_eventGroupHandle MamOS_createEventGroup(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setEventBits
+ * [Description]   : Sets specific bits in a specific event group, Then releases all the satisfied waiting tasks in
+ *                   a single pass and switches to the highest priority of them if it precedes the current task.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToSet>        -> Indicates to the bits to be set.
+ * [return]        : The function returns the event bits after releasing the waiting tasks.
+ ====================================================================================================================*/
+uint32 MamOS_setEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToSet);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setEventBitsFromISR
+ * [Description]   : Sets specific bits in a specific event group from an interrupt, The walk over the waiting tasks
+ *                   is deferred to the PendSV exception [the lowest priority], So the interrupt stays short and the
+ *                   released tasks are switched to by the same PendSV.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToSet>        -> Indicates to the bits to be set.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_setEventBitsFromISR(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToSet);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_clearEventBits
+ * [Description]   : Clears specific bits in a specific event group.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToClear>      -> Indicates to the bits to be cleared.
+ * [return]        : The function returns the event bits before clearing.
+ ====================================================================================================================*/
+uint32 MamOS_clearEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToClear);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitEventBits
+ * [Description]   : Waits for any or all of specific bits in a specific event group to be set, The task is blocked
+ *                   until the condition is satisfied or the timeout expires.
+ * [Arguments]     : <a_ptr2eventGroup>   -> Pointer to the required event group.
+ *                   <a_bitsToWait>       -> Indicates to the bits to be waited for [non-zero].
+ *                   <a_waitMode>         -> Indicates to the wait mode: - MAMOS_EVENT_WAIT_ANY.
+ *                                                                       - MAMOS_EVENT_WAIT_ALL.
+ *                   <a_clearOnExit>      -> Indicates whether the waited bits are cleared when satisfied or not.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns the event bits when the condition is satisfied [before clearing], Or
+ *                   the current event bits if the timeout expired.
+ ====================================================================================================================*/
+uint32 MamOS_waitEventBits(MamOS_eventGroupHandle a_ptr2eventGroup, uint32 a_bitsToWait, uint8 a_waitMode, uint8 a_clearOnExit, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createMemoryPool
+ * [Description]   : Creates a new memory pool of fixed-size blocks in the MamOS, The free blocks are linked through
+ *                   the blocks themselves, So the pool needs no extra memory.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the memory pool [supplied by the user,
+ *                                           word aligned, at least the aligned block size times blocks bytes].
+ *                   <a_blockSize>        -> Indicates to the size of a single block [in bytes, rounded up to words].
+ *                   <a_numOfBlocks>      -> Indicates to the number of blocks in the memory pool.
+ * [return]        : The function returns the handle to the created memory pool [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_memoryPoolHandle MamOS_createMemoryPool(void* a_ptr2storage, uint32 a_blockSize, uint32 a_numOfBlocks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryBlock
+ * [Description]   : Allocates a block from a specific memory pool in a constant time, The task is blocked while no
+ *                   block is free until a block is freed or the timeout expires.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns the address of the allocated block [or Null Pointer if the timeout expired].
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryBlockFromISR
+ * [Description]   : Allocates a block from a specific memory pool from an interrupt in a constant time.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the address of the allocated block [or Null Pointer if no block is free].
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryBlockFromISR(MamOS_memoryPoolHandle a_ptr2memoryPool);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryBlock
+ * [Description]   : Frees a block back to a specific memory pool in a constant time, The block is handed over
+ *                   directly to the highest priority waiting task [if any] and the CPU is switched to it if it
+ *                   precedes the current task.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_ptr2block>        -> Pointer to the block to be freed [allocated from the same pool].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool, void* a_ptr2block);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryBlockFromISR
+ * [Description]   : Frees a block back to a specific memory pool from an interrupt in a constant time, The context
+ *                   switch to the woken task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_ptr2block>        -> Pointer to the block to be freed [allocated from the same pool].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryBlockFromISR(MamOS_memoryPoolHandle a_ptr2memoryPool, void* a_ptr2block, uint8* a_ptr2higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMemoryPoolUsage
+ * [Description]   : Gets the number of the currently allocated blocks of a specific memory pool.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the number of the allocated blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getMemoryPoolUsage(MamOS_memoryPoolHandle a_ptr2memoryPool);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMemoryPoolHighWater
+ * [Description]   : Gets the highest number of blocks of a specific memory pool that were allocated at the same
+ *                   time since its creation [to size the pool for the worst case].
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the highest number of the allocated blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getMemoryPoolHighWater(MamOS_memoryPoolHandle a_ptr2memoryPool);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemory
+ * [Description]   : Allocates a variable-size memory block from the MamOS heap in a constant time [two-level
+ *                   segregated fit], The block is split and the rest of it stays free.
+ * [Arguments]     : <a_size>             -> Indicates to the required memory size [in bytes].
+ * [return]        : The function returns the address of the allocated memory [8-byte aligned], Or Null Pointer if
+ *                   no free block is large enough.
+ ====================================================================================================================*/
+void* MamOS_allocateMemory(uint32 a_size);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryFromISR
+ * [Description]   : Allocates a variable-size memory block from the MamOS heap from an interrupt in a constant time.
+ * [Arguments]     : <a_size>             -> Indicates to the required memory size [in bytes].
+ * [return]        : The function returns the address of the allocated memory [8-byte aligned], Or Null Pointer if
+ *                   no free block is large enough.
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryFromISR(uint32 a_size);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemory
+ * [Description]   : Frees a memory block back to the MamOS heap in a constant time, The block is merged at once
+ *                   with its free neighbours [immediate coalescing].
+ * [Arguments]     : <a_ptr2memory>       -> Pointer to the memory to be freed [allocated from the MamOS heap].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemory(void* a_ptr2memory);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryFromISR
+ * [Description]   : Frees a memory block back to the MamOS heap from an interrupt in a constant time.
+ * [Arguments]     : <a_ptr2memory>       -> Pointer to the memory to be freed [allocated from the MamOS heap].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryFromISR(void* a_ptr2memory);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapFreeSize
+ * [Description]   : Gets the total size of the free blocks in the MamOS heap [including their headers].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the free size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapFreeSize(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapMinFreeSize
+ * [Description]   : Gets the lowest total size of the free blocks in the MamOS heap since the kernel was initialized.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the lowest free size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapMinFreeSize(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapFreeBlocks
+ * [Description]   : Gets the number of the free blocks in the MamOS heap.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the number of the free blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getHeapFreeBlocks(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapLargestFreeBlock
+ * [Description]   : Gets the size of the largest free block in the MamOS heap [without its header], Compared with
+ *                   the free size, It indicates to the heap fragmentation.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the largest free block size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapLargestFreeBlock(void);
+
 #endif /* MAMOS_MAMOS_H_ */
@@ -22,7 +22,25 @@ Description  : Configuration file for MamOS kernel.
 #define MAMOS_SCHEDULER_TICK_TIME           (1U)         /* Time interval between scheduler ticks [in milliseconds]. */
 #define MAMOS_MAX_NUM_OF_TASKS              (3U)       /* Maximum number of tasks that can be created in the system. */
 #define MAMOS_MAX_STACK_SIZE                (80U)       /* Maximum stack size [in words] for any task in the system. */
+#define MAMOS_STACK_POOL_SIZE               (240U)        /* Sum of the stack sizes of the created tasks [in words]. */
 #define MAMOS_PREEMPRIVE_SCHEDULER          (TRUE)                  /* Enables or disables the preemptive scheduler. */
+
+/* The EDF policy orders the periodic tasks by their deadlines only, So their priorities are ignored, And the mutex
+ * priority inheritance and priority ceilings have no effect on them [the aperiodic tasks still use priorities]. */
+#define MAMOS_FIXED_PRIORITY_POLICY         (0U)                         /* Tasks are scheduled by their priorities. */
+#define MAMOS_EDF_POLICY                    (1U)                       /* Periodic tasks by earliest deadline first. */
+#define MAMOS_SCHEDULING_POLICY             (MAMOS_FIXED_PRIORITY_POLICY)       /* The FIXED_PRIORITY or EDF policy. */
+
+#define MAMOS_TIME_SLICING                  (TRUE)     /* Enables or disables round-robin among equal priority tasks. */
+#define MAMOS_TIME_SLICE_TICKS              (1U)       /* Time slice quantum of the equal priority tasks [in ticks]. */
 #define MAMOS_CPU_CLOCK_FREQ                (16000000UL)                               /* CPU clock frequency in Hz. */
+#define MAMOS_TIMER_WHEEL_SIZE              (32U)       /* Number of slots in the blocked queue wheel [power of two]. */
+#define MAMOS_TICKLESS_IDLE                 (FALSE)   /* Enables or disables suppressing the ticks while idle task runs. */
+#define MAMOS_TICKLESS_MIN_IDLE_TICKS       (2U)          /* Minimum idle period [in ticks] to suppress the ticks [>= 2]. */
+#define MAMOS_MAX_SYSCALL_PRIORITY          (0X50U)      /* Highest interrupt priority that can use the kernel APIs. */
+#define MAMOS_CRITICAL_PROFILING            (FALSE)        /* Measures the longest critical section [in CPU cycles]. */
+#define MAMOS_STACK_CANARY_CHECK            (FALSE)               /* Checks the stack bottom on each context switch. */
+#define MAMOS_MPU_PROTECTION                (FALSE)         /* Guards the task stacks and memory regions by the MPU. */
+#define MAMOS_HEAP_SIZE                     (8192U)     /* Size of the variable-size heap [in bytes, multiple of 8]. */
 
 #endif /* MAMOS_CONFIG_H_ */
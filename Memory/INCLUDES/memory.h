@@ -18,10 +18,175 @@ Description  : Interface file for the MamOS Memory module.
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_initMemory
- * [Description]   : Sets up the kernel stack by configuring the stack pointer to point to the kernel stack.
+ * [Description]   : Sets up the kernel stack by configuring the stack pointer to point to the kernel stack, Then
+ *                   sets up the variable-size memory heap.
  * [Arguments]     : <a_ptr2kernelStackPointer>    -> Pointer to the kernel stack pointer that needs to be initialized.
  * [return]        : The function returns void.
  ====================================================================================================================*/
 void MamOS_initMemory(uint32** a_ptr2kernelStackPointer);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateTaskStack
+ * [Description]   : Takes a task stack of an exact size from the kernel stack pool, The smallest stack freed by a
+ *                   deleted task that fits is reused first, Otherwise the stack is carved downward from the pool.
+ *                   The size is rounded up to double words, So each stack top stays 8-byte aligned [Or up to
+ *                   32-byte blocks if the MPU stack guards are enabled, So each stack base stays aligned for its
+ *                   guard].
+ * [Arguments]     : <a_stackSize>                 -> Indicates to the required stack size [in words].
+ * [return]        : The function returns the lowest address of the stack [or Null Pointer if the pool is
+ *                   exhausted].
+ ====================================================================================================================*/
+uint32* MamOS_allocateTaskStack(uint16 a_stackSize);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeTaskStack
+ * [Description]   : Returns the stack of a deleted task to the kernel stack pool, It's merged with the free stacks
+ *                   next to it, And a free stack at the bottom of the carved stacks goes back to the uncarved part
+ *                   of the pool [the stacks supplied by the user are left to the user].
+ * [Arguments]     : <a_ptr2stackBase>             -> Pointer to the lowest address of the stack.
+ *                   <a_stackSize>                 -> Indicates to the stack size [in words].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeTaskStack(uint32* a_ptr2stackBase, uint16 a_stackSize);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createMemoryPool
+ * [Description]   : Creates a new memory pool of fixed-size blocks in the MamOS, The free blocks are linked through
+ *                   the blocks themselves, So the pool needs no extra memory.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the memory pool [supplied by the user,
+ *                                           word aligned, at least the aligned block size times blocks bytes].
+ *                   <a_blockSize>        -> Indicates to the size of a single block [in bytes, rounded up to words].
+ *                   <a_numOfBlocks>      -> Indicates to the number of blocks in the memory pool.
+ * [return]        : The function returns the handle to the created memory pool [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_memoryPoolHandle MamOS_createMemoryPool(void* a_ptr2storage, uint32 a_blockSize, uint32 a_numOfBlocks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryBlock
+ * [Description]   : Allocates a block from a specific memory pool in a constant time, The task is blocked while no
+ *                   block is free until a block is freed or the timeout expires.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns the address of the allocated block [or Null Pointer if the timeout expired].
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryBlockFromISR
+ * [Description]   : Allocates a block from a specific memory pool from an interrupt in a constant time.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the address of the allocated block [or Null Pointer if no block is free].
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryBlockFromISR(MamOS_memoryPoolHandle a_ptr2memoryPool);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryBlock
+ * [Description]   : Frees a block back to a specific memory pool in a constant time, The block is handed over
+ *                   directly to the highest priority waiting task [if any] and the CPU is switched to it if it
+ *                   precedes the current task.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_ptr2block>        -> Pointer to the block to be freed [allocated from the same pool].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool, void* a_ptr2block);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryBlockFromISR
+ * [Description]   : Frees a block back to a specific memory pool from an interrupt in a constant time, The context
+ *                   switch to the woken task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_ptr2block>        -> Pointer to the block to be freed [allocated from the same pool].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryBlockFromISR(MamOS_memoryPoolHandle a_ptr2memoryPool, void* a_ptr2block, uint8* a_ptr2higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMemoryPoolUsage
+ * [Description]   : Gets the number of the currently allocated blocks of a specific memory pool.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the number of the allocated blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getMemoryPoolUsage(MamOS_memoryPoolHandle a_ptr2memoryPool);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMemoryPoolHighWater
+ * [Description]   : Gets the highest number of blocks of a specific memory pool that were allocated at the same
+ *                   time since its creation [to size the pool for the worst case].
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the highest number of the allocated blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getMemoryPoolHighWater(MamOS_memoryPoolHandle a_ptr2memoryPool);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemory
+ * [Description]   : Allocates a variable-size memory block from the MamOS heap in a constant time [two-level
+ *                   segregated fit], The block is split and the rest of it stays free.
+ * [Arguments]     : <a_size>             -> Indicates to the required memory size [in bytes].
+ * [return]        : The function returns the address of the allocated memory [8-byte aligned], Or Null Pointer if
+ *                   no free block is large enough.
+ ====================================================================================================================*/
+void* MamOS_allocateMemory(uint32 a_size);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryFromISR
+ * [Description]   : Allocates a variable-size memory block from the MamOS heap from an interrupt in a constant time.
+ * [Arguments]     : <a_size>             -> Indicates to the required memory size [in bytes].
+ * [return]        : The function returns the address of the allocated memory [8-byte aligned], Or Null Pointer if
+ *                   no free block is large enough.
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryFromISR(uint32 a_size);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemory
+ * [Description]   : Frees a memory block back to the MamOS heap in a constant time, The block is merged at once
+ *                   with its free neighbours [immediate coalescing].
+ * [Arguments]     : <a_ptr2memory>       -> Pointer to the memory to be freed [allocated from the MamOS heap].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemory(void* a_ptr2memory);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryFromISR
+ * [Description]   : Frees a memory block back to the MamOS heap from an interrupt in a constant time.
+ * [Arguments]     : <a_ptr2memory>       -> Pointer to the memory to be freed [allocated from the MamOS heap].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryFromISR(void* a_ptr2memory);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapFreeSize
+ * [Description]   : Gets the total size of the free blocks in the MamOS heap [including their headers].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the free size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapFreeSize(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapMinFreeSize
+ * [Description]   : Gets the lowest total size of the free blocks in the MamOS heap since the kernel was initialized.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the lowest free size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapMinFreeSize(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapFreeBlocks
+ * [Description]   : Gets the number of the free blocks in the MamOS heap.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the number of the free blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getHeapFreeBlocks(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapLargestFreeBlock
+ * [Description]   : Gets the size of the largest free block in the MamOS heap [without its header], Compared with
+ *                   the free size, It indicates to the heap fragmentation.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the largest free block size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapLargestFreeBlock(void);
+
 #endif /* MAMOS_MEMORY_INCLUDES_MEMORY_H_ */
@@ -12,10 +12,208 @@ Description  : Private file for the MamOS Memory module.
 #ifndef MAMOS_MEMORY_INCLUDES_MEMORY_PRV_H_
 #define MAMOS_MEMORY_INCLUDES_MEMORY_PRV_H_
 
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/* Words kept at the bottom of the kernel stack, So the MPU guard of the lowest task stack stays inside it. */
+#if (MAMOS_MPU_PROTECTION == TRUE)
+#define MAMOS_STACK_POOL_RESERVE              (MAMOS_STACK_GUARD_SIZE)
+#else
+#define MAMOS_STACK_POOL_RESERVE              (0U)
+#endif
+
+typedef struct
+{
+    MamOS_memoryPoolHandle ptr2memoryPool;                  /* The required memory pool.                             */
+    void* ptr2block;                                        /* The allocated or freed block.                         */
+    uint32 timeoutTicks;                                    /* Maximum waiting time [in ticks].                      */
+}MamOS_memoryRequestType;
+
+typedef struct
+{
+    uint32* ptr2stackBase;                                  /* Lowest address of the free stack.                     */
+    uint32 stackSize;                                       /* Size of the free stack [in words].                    */
+}MamOS_freeStackType;
+
+#define MAMOS_HEAP_ALIGNMENT_LOG2             (3U)                    /* The heap blocks are 8-byte aligned.         */
+#define MAMOS_HEAP_SL_COUNT_LOG2              (4U)                    /* Each first level splits to 16 free lists.   */
+#define MAMOS_HEAP_SL_COUNT                   (1U << MAMOS_HEAP_SL_COUNT_LOG2)
+#define MAMOS_HEAP_FL_SHIFT                   (MAMOS_HEAP_SL_COUNT_LOG2 + MAMOS_HEAP_ALIGNMENT_LOG2)
+#define MAMOS_HEAP_SMALL_BLOCK_SIZE           (1U << MAMOS_HEAP_FL_SHIFT)
+#define MAMOS_HEAP_FL_INDEX_MAX               (17U)                   /* The blocks are below 128 KB [2 ^ 17].       */
+#define MAMOS_HEAP_FL_COUNT                   (MAMOS_HEAP_FL_INDEX_MAX - MAMOS_HEAP_FL_SHIFT + 1U)
+#define MAMOS_HEAP_BLOCK_HEADER_SIZE          (8U)                    /* Physical neighbour link and block size.     */
+#define MAMOS_HEAP_MIN_BLOCK_SIZE             (16U)                   /* Header and the free list links.             */
+#define MAMOS_HEAP_FREE_BLOCK                 (1UL)                   /* Block size flag: the block is free.         */
+
+typedef struct heapBlock
+{
+    struct heapBlock* ptr2prevPhysBlock;                    /* The block right before it in memory [or Null Pointer]. */
+    uint32 blockSize;                                       /* Size including the header, Bit 0 marks a free block.  */
+    struct heapBlock* ptr2nextFreeBlock;                    /* Next block in the same free list [free blocks only].  */
+    struct heapBlock* ptr2prevFreeBlock;                    /* Previous block in the same free list [free only].     */
+}MamOS_heapBlockType;
+
+typedef struct
+{
+    uint32 firstLevelBitmap;                                /* Bit per first level that has a non-empty free list.   */
+    uint32 secondLevelBitmaps[MAMOS_HEAP_FL_COUNT];         /* Bit per non-empty free list in each first level.      */
+    MamOS_heapBlockType* freeLists[MAMOS_HEAP_FL_COUNT][MAMOS_HEAP_SL_COUNT];            /* Heads of the free lists. */
+    uint32 freeSize;                                        /* Total size of the free blocks [in bytes].             */
+    uint32 minFreeSize;                                     /* Lowest total size of the free blocks [in bytes].      */
+    uint32 freeBlocks;                                      /* Current number of the free blocks.                    */
+}MamOS_heapControlType;
+
+typedef struct
+{
+    uint32 size;                                            /* The required memory size [in bytes].                  */
+    void* ptr2memory;                                       /* The allocated memory.                                 */
+}MamOS_heapRequestType;
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Rounds a heap memory size up to a whole number of the heap alignment. */
+#define MAMOS_ALIGN_HEAP_SIZE(SIZE)           (((SIZE) + 7U) & ~7U)
+
+/* Gets the size of a specific heap block without its free flag. */
+#define MAMOS_HEAP_BLOCK_SIZE(BLOCK)          ((BLOCK)->blockSize & ~MAMOS_HEAP_FREE_BLOCK)
+
+/* Gets the block right after a specific heap block in memory. */
+#define MAMOS_HEAP_NEXT_PHYS_BLOCK(BLOCK)     ((MamOS_heapBlockType*)((uint8*)(BLOCK) + MAMOS_HEAP_BLOCK_SIZE(BLOCK)))
+
+/* Gets the index of the most significant set bit of a non-zero word [compiles to a single CLZ instruction]. */
+#define MAMOS_FIND_LAST_SET(WORD)             (31U - (uint32)__builtin_clz((uint32)(WORD)))
+
+/* Gets the index of the least significant set bit of a non-zero word [compiles to RBIT and CLZ instructions]. */
+#define MAMOS_FIND_FIRST_SET(WORD)            ((uint32)__builtin_ctz((uint32)(WORD)))
+
 /*=====================================================================================================================
                                       < Private Functions Prototypes >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_removeFreeStack
+ * [Description]   : Removes a specific free stack from the free stacks of the kernel stack pool [their order
+ *                   doesn't matter, So the last free stack takes its place].
+ * [Arguments]     : <a_freeStackIndex>   -> Indicates to the index of the free stack.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_removeFreeStack(uint8 a_freeStackIndex);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeMemoryBlock
+ * [Description]   : Takes the first free block of a specific memory pool without blocking, And updates the usage
+ *                   statistics [called inside a critical section].
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the address of the taken block [or Null Pointer if no block is free].
+ ====================================================================================================================*/
+static void* MamOS_takeMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_putMemoryBlock
+ * [Description]   : Puts a block back without blocking, Directly to the highest priority waiting task [if any] or
+ *                   to the free blocks of the memory pool [called inside a critical section].
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_ptr2block>        -> Pointer to the block to be put back.
+ *                   <a_ptr2wokenTask>    -> Pointer to a variable to store the woken task [if any].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_putMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool, void* a_ptr2block, MamOS_taskControlBlockType** a_ptr2wokenTask);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryBlockCall
+ * [Description]   : Handles allocating a block from a specific memory pool [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the allocation request.
+ * [return]        : The function returns TRUE if a block is allocated, FALSE if no block is free, Or pending if
+ *                   the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_allocateMemoryBlockCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryBlockCall
+ * [Description]   : Handles freeing a block back to a specific memory pool [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the free request.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_freeMemoryBlockCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_initHeap
+ * [Description]   : Sets up the MamOS heap as a single free block that spans the heap region.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_initHeap(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_mapHeapBlockSize
+ * [Description]   : Maps a block size to its first and second level indices in the free lists matrix.
+ * [Arguments]     : <a_blockSize>        -> Indicates to the block size [in bytes].
+ *                   <a_ptr2firstLevel>   -> Pointer to a variable to store the first level index.
+ *                   <a_ptr2secondLevel>  -> Pointer to a variable to store the second level index.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_mapHeapBlockSize(uint32 a_blockSize, uint32* a_ptr2firstLevel, uint32* a_ptr2secondLevel);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_insertHeapBlock
+ * [Description]   : Marks a specific block as free and inserts it at the head of its free list.
+ * [Arguments]     : <a_ptr2block>        -> Pointer to the required block.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_insertHeapBlock(MamOS_heapBlockType* a_ptr2block);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_removeHeapBlock
+ * [Description]   : Removes a specific free block from its free list and marks it as used.
+ * [Arguments]     : <a_ptr2block>        -> Pointer to the required block.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_removeHeapBlock(MamOS_heapBlockType* a_ptr2block);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeHeapMemory
+ * [Description]   : Takes a free block that fits a specific size from the MamOS heap and splits the rest of it
+ *                   [called inside a critical section].
+ * [Arguments]     : <a_size>             -> Indicates to the required memory size [in bytes].
+ * [return]        : The function returns the address of the taken memory [or Null Pointer if no block fits].
+ ====================================================================================================================*/
+static void* MamOS_takeHeapMemory(uint32 a_size);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_putHeapMemory
+ * [Description]   : Puts a memory block back to the MamOS heap after merging it with its free neighbours [called
+ *                   inside a critical section].
+ * [Arguments]     : <a_ptr2memory>       -> Pointer to the memory to be put back.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_putHeapMemory(void* a_ptr2memory);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryCall
+ * [Description]   : Handles allocating memory from the MamOS heap [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the allocation request.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_allocateMemoryCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryCall
+ * [Description]   : Handles freeing memory back to the MamOS heap [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the memory to be freed.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_freeMemoryCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getLargestFreeBlockCall
+ * [Description]   : Handles finding the largest free block in the MamOS heap [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Not used.
+ * [return]        : The function returns the largest free block size [in bytes].
+ ====================================================================================================================*/
+static uint32 MamOS_getLargestFreeBlockCall(void* a_ptr2argument);
 
 #endif /* MAMOS_MEMORY_INCLUDES_MEMORY_PRV_H_ */
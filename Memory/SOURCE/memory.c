@@ -11,7 +11,13 @@ Description  : Source file for the MamOS Memory module.
 
 /*=====================================================================================================================
  * [Details]     : This module handles memory management operations in MamOS RTOS,
- *                 including kernel stack initialization and memory space allocation.
+ *                 including kernel stack initialization and memory space allocation. It also hosts the fixed-block
+ *                 memory pools, The free blocks of a pool are linked through the blocks themselves, So a block is
+ *                 allocated or freed in a constant time without fragmentation, And the tasks that wait for a free
+ *                 block wait in a priority ordered waiting queue with an optional timeout. The variable-size
+ *                 memory heap is a two-level segregated fit allocator [TLSF], The free blocks are kept in lists by
+ *                 size classes that two bitmaps index, So both allocation and free take a constant time, And the
+ *                 freed blocks are merged with their free neighbours at once.
  * [Future Work] : Support memory protection to prevent any task from overwriting the memory space of another.
  ====================================================================================================================*/
 
@@ -21,6 +27,9 @@ Description  : Source file for the MamOS Memory module.
 
 #include "../../Others/std_types.h"
 #include "../../Others/kernel_defs.h"
+#include "../../Queue/INCLUDES/queue.h"
+#include "../../Scheduler/INCLUDES/scheduler.h"
+#include "../../Core/INCLUDES/core.h"
 #include "../INCLUDES/memory_prv.h"
 #include "../INCLUDES/memory.h"
 
@@ -28,8 +37,29 @@ Description  : Source file for the MamOS Memory module.
                                            < Global Variables >
 =====================================================================================================================*/
 
-/* Static array that serves as the kernel's dedicated stack space. */
-volatile static uint32 G_kernelStack[MAMOS_KERNEL_STACK_SIZE] = {0};
+#if (MAMOS_MPU_PROTECTION == TRUE)
+/* Static array that serves as the kernel's dedicated stack space [32-byte aligned for the MPU stack guards]. */
+volatile static uint32 G_kernelStack[MAMOS_KERNEL_STACK_SIZE] __attribute__((aligned(32))) = {0};
+#else
+/* Static array that serves as the kernel's dedicated stack space [8-byte aligned for the task stack tops]. */
+volatile static uint32 G_kernelStack[MAMOS_KERNEL_STACK_SIZE] __attribute__((aligned(8))) = {0};
+#endif
+
+/* Stacks returned to the kernel stack pool by the deleted tasks, And the number of them. */
+static MamOS_freeStackType G_freeStacks[MAMOS_TOTAL_NUM_OF_TASKS];
+static uint8 G_freeStacksCounter = 0;
+
+/* Array of memory pools that available in the system. */
+volatile MamOS_memoryPoolType G_memoryPoolHeap[MAMOS_MAX_NUM_OF_MEMORY_POOLS] = {0};
+
+/* Static array that serves as the region of the variable-size memory heap [8-byte aligned]. */
+static uint64 G_heapRegion[MAMOS_HEAP_SIZE / 8U] = {0};
+
+/* Control structure of the free lists of the variable-size memory heap. */
+static MamOS_heapControlType G_heapControl;
+
+/* Extern the Kernel Control Panel. */
+extern MamOS_kernelControlPanelType G_kernelControlPanel;
 
 /*=====================================================================================================================
                                           < Functions Definitions >
@@ -37,11 +67,894 @@ volatile static uint32 G_kernelStack[MAMOS_KERNEL_STACK_SIZE] = {0};
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_initMemory
- * [Description]   : Sets up the kernel stack by configuring the stack pointer to point to the kernel stack.
+ * [Description]   : Sets up the kernel stack by configuring the stack pointer to point to the kernel stack, Then
+ *                   sets up the variable-size memory heap.
  * [Arguments]     : <a_ptr2kernelStackPointer>    -> Pointer to the kernel stack pointer that needs to be initialized.
  * [return]        : The function returns void.
  ====================================================================================================================*/
 void MamOS_initMemory(uint32** a_ptr2kernelStackPointer)
 {
     *a_ptr2kernelStackPointer = G_kernelStack + MAMOS_KERNEL_STACK_SIZE;
+
+    MamOS_initHeap();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateTaskStack
+ * [Description]   : Takes a task stack of an exact size from the kernel stack pool, The smallest stack freed by a
+ *                   deleted task that fits is reused first, Otherwise the stack is carved downward from the pool.
+ *                   The size is rounded up to double words, So each stack top stays 8-byte aligned [Or up to
+ *                   32-byte blocks if the MPU stack guards are enabled, So each stack base stays aligned for its
+ *                   guard].
+ * [Arguments]     : <a_stackSize>                 -> Indicates to the required stack size [in words].
+ * [return]        : The function returns the lowest address of the stack [or Null Pointer if the pool is
+ *                   exhausted].
+ ====================================================================================================================*/
+uint32* MamOS_allocateTaskStack(uint16 a_stackSize)
+{
+    uint32* LOC_ptr2stackBase = NULL_PTR;
+    uint32 LOC_stackSize = MAMOS_ALIGN_STACK_SIZE(a_stackSize);
+    uint8 LOC_bestIndex = MAMOS_TOTAL_NUM_OF_TASKS;
+
+    /* Search for the smallest free stack that fits [the free stacks are fewer than the tasks]. */
+    for(uint8 LOC_freeStackIndex = 0; LOC_freeStackIndex < G_freeStacksCounter; LOC_freeStackIndex++)
+    {
+        if((G_freeStacks[LOC_freeStackIndex].stackSize >= LOC_stackSize) &&
+           ((LOC_bestIndex == MAMOS_TOTAL_NUM_OF_TASKS) || (G_freeStacks[LOC_freeStackIndex].stackSize < G_freeStacks[LOC_bestIndex].stackSize)))
+        {
+            LOC_bestIndex = LOC_freeStackIndex;
+        }
+    }
+
+    if(LOC_bestIndex != MAMOS_TOTAL_NUM_OF_TASKS)
+    {
+        /* Take the stack from the top of the free stack, So the rest of it keeps its aligned base. */
+        G_freeStacks[LOC_bestIndex].stackSize -= LOC_stackSize;
+        LOC_ptr2stackBase = G_freeStacks[LOC_bestIndex].ptr2stackBase + G_freeStacks[LOC_bestIndex].stackSize;
+
+        if(G_freeStacks[LOC_bestIndex].stackSize == 0)
+        {
+            MamOS_removeFreeStack(LOC_bestIndex);
+        }
+    }
+
+    /* The stacks are carved downward from the top of the kernel stack, So the pool is exhausted once the next stack
+     * crosses the bottom of it [above the words reserved for the guard of the lowest stack]. */
+    else if((LOC_stackSize + MAMOS_STACK_POOL_RESERVE) <= (uint32)(G_kernelControlPanel.kernelStackPointer - G_kernelStack))
+    {
+        G_kernelControlPanel.kernelStackPointer -= LOC_stackSize;
+        LOC_ptr2stackBase = G_kernelControlPanel.kernelStackPointer;
+    }
+
+    else
+    {
+        /* Invalid Operation. */
+    }
+
+    return LOC_ptr2stackBase;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeTaskStack
+ * [Description]   : Returns the stack of a deleted task to the kernel stack pool, It's merged with the free stacks
+ *                   next to it, And a free stack at the bottom of the carved stacks goes back to the uncarved part
+ *                   of the pool [the stacks supplied by the user are left to the user].
+ * [Arguments]     : <a_ptr2stackBase>             -> Pointer to the lowest address of the stack.
+ *                   <a_stackSize>                 -> Indicates to the stack size [in words].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeTaskStack(uint32* a_ptr2stackBase, uint16 a_stackSize)
+{
+    uint32* LOC_ptr2stackBase = a_ptr2stackBase;
+    uint32 LOC_stackSize = a_stackSize;
+    uint8 LOC_freeStackIndex = 0;
+
+    if((a_ptr2stackBase < G_kernelStack) || (a_ptr2stackBase >= (G_kernelStack + MAMOS_KERNEL_STACK_SIZE)))
+    {
+        /* Invalid Operation [the stack isn't carved from the kernel stack pool]. */
+    }
+
+    else
+    {
+        /* Merge the free stacks right below and right above it, So the free space isn't split into smaller stacks. */
+        while(LOC_freeStackIndex < G_freeStacksCounter)
+        {
+            if((G_freeStacks[LOC_freeStackIndex].ptr2stackBase + G_freeStacks[LOC_freeStackIndex].stackSize) == LOC_ptr2stackBase)
+            {
+                LOC_ptr2stackBase = G_freeStacks[LOC_freeStackIndex].ptr2stackBase;
+                LOC_stackSize += G_freeStacks[LOC_freeStackIndex].stackSize;
+                MamOS_removeFreeStack(LOC_freeStackIndex);
+            }
+
+            else if((LOC_ptr2stackBase + LOC_stackSize) == G_freeStacks[LOC_freeStackIndex].ptr2stackBase)
+            {
+                LOC_stackSize += G_freeStacks[LOC_freeStackIndex].stackSize;
+                MamOS_removeFreeStack(LOC_freeStackIndex);
+            }
+
+            else
+            {
+                LOC_freeStackIndex++;
+            }
+        }
+
+        /* A free stack at the bottom of the carved stacks goes back to the uncarved part of the pool, Otherwise it's
+         * a gap right below a carved stack [so there are never more free stacks than tasks]. */
+        if(LOC_ptr2stackBase == G_kernelControlPanel.kernelStackPointer)
+        {
+            G_kernelControlPanel.kernelStackPointer += LOC_stackSize;
+        }
+
+        else
+        {
+            G_freeStacks[G_freeStacksCounter].ptr2stackBase = LOC_ptr2stackBase;
+            G_freeStacks[G_freeStacksCounter].stackSize = LOC_stackSize;
+            G_freeStacksCounter++;
+        }
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_removeFreeStack
+ * [Description]   : Removes a specific free stack from the free stacks of the kernel stack pool [their order
+ *                   doesn't matter, So the last free stack takes its place].
+ * [Arguments]     : <a_freeStackIndex>   -> Indicates to the index of the free stack.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_removeFreeStack(uint8 a_freeStackIndex)
+{
+    G_freeStacksCounter--;
+    G_freeStacks[a_freeStackIndex] = G_freeStacks[G_freeStacksCounter];
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createMemoryPool
+ * [Description]   : Creates a new memory pool of fixed-size blocks in the MamOS, The free blocks are linked through
+ *                   the blocks themselves, So the pool needs no extra memory.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the memory pool [supplied by the user,
+ *                                           word aligned, at least the aligned block size times blocks bytes].
+ *                   <a_blockSize>        -> Indicates to the size of a single block [in bytes, rounded up to words].
+ *                   <a_numOfBlocks>      -> Indicates to the number of blocks in the memory pool.
+ * [return]        : The function returns the handle to the created memory pool [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_memoryPoolHandle MamOS_createMemoryPool(void* a_ptr2storage, uint32 a_blockSize, uint32 a_numOfBlocks)
+{
+    MamOS_memoryPoolHandle LOC_createdMemoryPoolHandle = NULL_PTR;
+
+    if(G_kernelControlPanel.memoryPoolCounter >= MAMOS_MAX_NUM_OF_MEMORY_POOLS)
+    {
+        /* Invalid Operation. */
+    }
+
+    else if((a_ptr2storage == NULL_PTR) || (((uint32)a_ptr2storage & 3U) != 0))
+    {
+        /* Invalid Operation. */
+    }
+
+    else if((a_blockSize == 0) || (a_numOfBlocks == 0))
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        uint8* LOC_ptr2block = a_ptr2storage;
+        uint32 LOC_blockSize = MAMOS_ALIGN_BLOCK_SIZE(a_blockSize);
+
+        /* Get the handle of the created memory pool and increment the memory pool counter. */
+        LOC_createdMemoryPoolHandle = &G_memoryPoolHeap[G_kernelControlPanel.memoryPoolCounter];
+        G_kernelControlPanel.memoryPoolCounter++;
+
+        /* Link each block to the next one, So all the blocks are initially free. */
+        for(uint32 LOC_blockIndex = 0; LOC_blockIndex < (a_numOfBlocks - 1); LOC_blockIndex++)
+        {
+            *(void**)LOC_ptr2block = LOC_ptr2block + LOC_blockSize;
+            LOC_ptr2block += LOC_blockSize;
+        }
+
+        *(void**)LOC_ptr2block = NULL_PTR;
+
+        /* Initialize the new memory pool. */
+        LOC_createdMemoryPoolHandle->ptr2freeBlocks = a_ptr2storage;
+        LOC_createdMemoryPoolHandle->blockSize = LOC_blockSize;
+        LOC_createdMemoryPoolHandle->numOfBlocks = a_numOfBlocks;
+        LOC_createdMemoryPoolHandle->usedBlocks = 0;
+        LOC_createdMemoryPoolHandle->maxUsedBlocks = 0;
+        LOC_createdMemoryPoolHandle->waitingQueue.queueSize = 0;
+        LOC_createdMemoryPoolHandle->waitingQueue.ptr2headTask = NULL_PTR;
+        LOC_createdMemoryPoolHandle->waitingQueue.ptr2rearTask = NULL_PTR;
+    }
+
+    return LOC_createdMemoryPoolHandle;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryBlock
+ * [Description]   : Allocates a block from a specific memory pool in a constant time, The task is blocked while no
+ *                   block is free until a block is freed or the timeout expires.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns the address of the allocated block [or Null Pointer if the timeout expired].
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool, uint32 a_timeoutTicks)
+{
+    MamOS_memoryRequestType LOC_request = {a_ptr2memoryPool, NULL_PTR, a_timeoutTicks};
+
+    /* The task is blocked when no block is free, So the block [if any] is stored in the request once a freed block
+     * is handed over to the task, And the request stays empty if the timeout expires. */
+    MamOS_kernelCall(MamOS_allocateMemoryBlockCall, &LOC_request);
+
+    return LOC_request.ptr2block;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryBlockFromISR
+ * [Description]   : Allocates a block from a specific memory pool from an interrupt in a constant time.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the address of the allocated block [or Null Pointer if no block is free].
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryBlockFromISR(MamOS_memoryPoolHandle a_ptr2memoryPool)
+{
+    void* LOC_ptr2block = NULL_PTR;
+
+    MamOS_enterCritical();
+
+    LOC_ptr2block = MamOS_takeMemoryBlock(a_ptr2memoryPool);
+
+    MamOS_exitCritical();
+
+    return LOC_ptr2block;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryBlock
+ * [Description]   : Frees a block back to a specific memory pool in a constant time, The block is handed over
+ *                   directly to the highest priority waiting task [if any] and the CPU is switched to it if it
+ *                   precedes the current task.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_ptr2block>        -> Pointer to the block to be freed [allocated from the same pool].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool, void* a_ptr2block)
+{
+    MamOS_memoryRequestType LOC_request = {a_ptr2memoryPool, a_ptr2block, 0};
+
+    if(a_ptr2block != NULL_PTR)
+    {
+        MamOS_kernelCall(MamOS_freeMemoryBlockCall, &LOC_request);
+    }
+
+    else
+    {
+        /* Invalid Operation. */
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryBlockFromISR
+ * [Description]   : Frees a block back to a specific memory pool from an interrupt in a constant time, The context
+ *                   switch to the woken task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_ptr2block>        -> Pointer to the block to be freed [allocated from the same pool].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryBlockFromISR(MamOS_memoryPoolHandle a_ptr2memoryPool, void* a_ptr2block, uint8* a_ptr2higherPriorityTaskWoken)
+{
+    MamOS_taskControlBlockType* LOC_ptr2wokenTask = NULL_PTR;
+
+    if(a_ptr2block != NULL_PTR)
+    {
+        MamOS_enterCritical();
+
+        MamOS_putMemoryBlock(a_ptr2memoryPool, a_ptr2block, &LOC_ptr2wokenTask);
+
+        if((LOC_ptr2wokenTask != NULL_PTR) && (a_ptr2higherPriorityTaskWoken != NULL_PTR))
+        {
+            if(MamOS_isTaskPreceding(LOC_ptr2wokenTask, G_kernelControlPanel.ptr2standbyTask) == TRUE)
+            {
+                *a_ptr2higherPriorityTaskWoken = TRUE;
+            }
+        }
+
+        MamOS_exitCritical();
+    }
+
+    else
+    {
+        /* Invalid Operation. */
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMemoryPoolUsage
+ * [Description]   : Gets the number of the currently allocated blocks of a specific memory pool.
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the number of the allocated blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getMemoryPoolUsage(MamOS_memoryPoolHandle a_ptr2memoryPool)
+{
+    return a_ptr2memoryPool->usedBlocks;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getMemoryPoolHighWater
+ * [Description]   : Gets the highest number of blocks of a specific memory pool that were allocated at the same
+ *                   time since its creation [to size the pool for the worst case].
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the highest number of the allocated blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getMemoryPoolHighWater(MamOS_memoryPoolHandle a_ptr2memoryPool)
+{
+    return a_ptr2memoryPool->maxUsedBlocks;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeMemoryBlock
+ * [Description]   : Takes the first free block of a specific memory pool without blocking, And updates the usage
+ *                   statistics [called inside a critical section].
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ * [return]        : The function returns the address of the taken block [or Null Pointer if no block is free].
+ ====================================================================================================================*/
+static void* MamOS_takeMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool)
+{
+    void* LOC_ptr2block = a_ptr2memoryPool->ptr2freeBlocks;
+
+    if(LOC_ptr2block != NULL_PTR)
+    {
+        /* A free block holds the address of the next free block in its first word. */
+        a_ptr2memoryPool->ptr2freeBlocks = *(void**)LOC_ptr2block;
+        a_ptr2memoryPool->usedBlocks++;
+
+        if(a_ptr2memoryPool->usedBlocks > a_ptr2memoryPool->maxUsedBlocks)
+        {
+            a_ptr2memoryPool->maxUsedBlocks = a_ptr2memoryPool->usedBlocks;
+        }
+    }
+
+    else
+    {
+        /* No free blocks. */
+    }
+
+    return LOC_ptr2block;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_putMemoryBlock
+ * [Description]   : Puts a block back without blocking, Directly to the highest priority waiting task [if any] or
+ *                   to the free blocks of the memory pool [called inside a critical section].
+ * [Arguments]     : <a_ptr2memoryPool>   -> Pointer to the required memory pool.
+ *                   <a_ptr2block>        -> Pointer to the block to be put back.
+ *                   <a_ptr2wokenTask>    -> Pointer to a variable to store the woken task [if any].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_putMemoryBlock(MamOS_memoryPoolHandle a_ptr2memoryPool, void* a_ptr2block, MamOS_taskControlBlockType** a_ptr2wokenTask)
+{
+    MamOS_taskControlBlockType* LOC_ptr2waitingTask = a_ptr2memoryPool->waitingQueue.ptr2headTask;
+
+    /* Tasks wait only while no block is free, So the block is handed over without touching the free blocks [and it
+     * stays allocated, So the usage is unchanged]. */
+    if(LOC_ptr2waitingTask != NULL_PTR)
+    {
+        ((MamOS_memoryRequestType*)LOC_ptr2waitingTask->ptr2waitingData)->ptr2block = a_ptr2block;
+        MamOS_wakeFromWaitingQueue(LOC_ptr2waitingTask);
+        *a_ptr2wokenTask = LOC_ptr2waitingTask;
+    }
+
+    else
+    {
+        *(void**)a_ptr2block = a_ptr2memoryPool->ptr2freeBlocks;
+        a_ptr2memoryPool->ptr2freeBlocks = a_ptr2block;
+        a_ptr2memoryPool->usedBlocks--;
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryBlockCall
+ * [Description]   : Handles allocating a block from a specific memory pool [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the allocation request.
+ * [return]        : The function returns TRUE if a block is allocated, FALSE if no block is free, Or pending if
+ *                   the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_allocateMemoryBlockCall(void* a_ptr2argument)
+{
+    uint32 LOC_result = TRUE;
+    MamOS_memoryRequestType* LOC_ptr2request = a_ptr2argument;
+
+    LOC_ptr2request->ptr2block = MamOS_takeMemoryBlock(LOC_ptr2request->ptr2memoryPool);
+
+    if(LOC_ptr2request->ptr2block != NULL_PTR)
+    {
+        /* The block is allocated without blocking. */
+    }
+
+    else if(LOC_ptr2request->timeoutTicks == 0)
+    {
+        LOC_result = FALSE;
+    }
+
+    else
+    {
+        MamOS_addToWaitingQueue(&LOC_ptr2request->ptr2memoryPool->waitingQueue, G_kernelControlPanel.ptr2activeTask, LOC_ptr2request->timeoutTicks);
+        G_kernelControlPanel.ptr2activeTask->ptr2waitingData = LOC_ptr2request;
+        MamOS_forceTaskTransition();
+        LOC_result = MAMOS_WAIT_RESULT_PENDING;
+    }
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryBlockCall
+ * [Description]   : Handles freeing a block back to a specific memory pool [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the free request.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_freeMemoryBlockCall(void* a_ptr2argument)
+{
+    MamOS_memoryRequestType* LOC_ptr2request = a_ptr2argument;
+    MamOS_taskControlBlockType* LOC_ptr2wokenTask = NULL_PTR;
+
+    MamOS_putMemoryBlock(LOC_ptr2request->ptr2memoryPool, LOC_ptr2request->ptr2block, &LOC_ptr2wokenTask);
+
+    if(LOC_ptr2wokenTask != NULL_PTR)
+    {
+        MamOS_yieldFromISR(MamOS_isTaskPreceding(LOC_ptr2wokenTask, G_kernelControlPanel.ptr2standbyTask));
+    }
+
+    return 0;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemory
+ * [Description]   : Allocates a variable-size memory block from the MamOS heap in a constant time [two-level
+ *                   segregated fit], The block is split and the rest of it stays free.
+ * [Arguments]     : <a_size>             -> Indicates to the required memory size [in bytes].
+ * [return]        : The function returns the address of the allocated memory [8-byte aligned], Or Null Pointer if
+ *                   no free block is large enough.
+ ====================================================================================================================*/
+void* MamOS_allocateMemory(uint32 a_size)
+{
+    MamOS_heapRequestType LOC_request = {a_size, NULL_PTR};
+
+    MamOS_kernelCall(MamOS_allocateMemoryCall, &LOC_request);
+
+    return LOC_request.ptr2memory;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryFromISR
+ * [Description]   : Allocates a variable-size memory block from the MamOS heap from an interrupt in a constant time.
+ * [Arguments]     : <a_size>             -> Indicates to the required memory size [in bytes].
+ * [return]        : The function returns the address of the allocated memory [8-byte aligned], Or Null Pointer if
+ *                   no free block is large enough.
+ ====================================================================================================================*/
+void* MamOS_allocateMemoryFromISR(uint32 a_size)
+{
+    void* LOC_ptr2memory = NULL_PTR;
+
+    MamOS_enterCritical();
+
+    LOC_ptr2memory = MamOS_takeHeapMemory(a_size);
+
+    MamOS_exitCritical();
+
+    return LOC_ptr2memory;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemory
+ * [Description]   : Frees a memory block back to the MamOS heap in a constant time, The block is merged at once
+ *                   with its free neighbours [immediate coalescing].
+ * [Arguments]     : <a_ptr2memory>       -> Pointer to the memory to be freed [allocated from the MamOS heap].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemory(void* a_ptr2memory)
+{
+    MamOS_kernelCall(MamOS_freeMemoryCall, a_ptr2memory);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryFromISR
+ * [Description]   : Frees a memory block back to the MamOS heap from an interrupt in a constant time.
+ * [Arguments]     : <a_ptr2memory>       -> Pointer to the memory to be freed [allocated from the MamOS heap].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_freeMemoryFromISR(void* a_ptr2memory)
+{
+    MamOS_enterCritical();
+
+    MamOS_putHeapMemory(a_ptr2memory);
+
+    MamOS_exitCritical();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapFreeSize
+ * [Description]   : Gets the total size of the free blocks in the MamOS heap [including their headers].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the free size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapFreeSize(void)
+{
+    return G_heapControl.freeSize;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapMinFreeSize
+ * [Description]   : Gets the lowest total size of the free blocks in the MamOS heap since the kernel was initialized.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the lowest free size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapMinFreeSize(void)
+{
+    return G_heapControl.minFreeSize;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapFreeBlocks
+ * [Description]   : Gets the number of the free blocks in the MamOS heap.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the number of the free blocks.
+ ====================================================================================================================*/
+uint32 MamOS_getHeapFreeBlocks(void)
+{
+    return G_heapControl.freeBlocks;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHeapLargestFreeBlock
+ * [Description]   : Gets the size of the largest free block in the MamOS heap [without its header], Compared with
+ *                   the free size, It indicates to the heap fragmentation.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the largest free block size [in bytes].
+ ====================================================================================================================*/
+uint32 MamOS_getHeapLargestFreeBlock(void)
+{
+    return MamOS_kernelCall(MamOS_getLargestFreeBlockCall, NULL_PTR);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_initHeap
+ * [Description]   : Sets up the MamOS heap as a single free block that spans the heap region.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_initHeap(void)
+{
+    MamOS_heapBlockType* LOC_ptr2firstBlock = (MamOS_heapBlockType*)G_heapRegion;
+    MamOS_heapBlockType* LOC_ptr2endBlock = NULL_PTR;
+
+    G_heapControl.firstLevelBitmap = 0;
+    G_heapControl.freeSize = 0;
+    G_heapControl.freeBlocks = 0;
+
+    for(uint32 LOC_firstLevel = 0; LOC_firstLevel < MAMOS_HEAP_FL_COUNT; LOC_firstLevel++)
+    {
+        G_heapControl.secondLevelBitmaps[LOC_firstLevel] = 0;
+
+        for(uint32 LOC_secondLevel = 0; LOC_secondLevel < MAMOS_HEAP_SL_COUNT; LOC_secondLevel++)
+        {
+            G_heapControl.freeLists[LOC_firstLevel][LOC_secondLevel] = NULL_PTR;
+        }
+    }
+
+    /* The whole region is one free block, Followed by a used end marker [header only], So the last block is never
+     * merged beyond the region. */
+    LOC_ptr2firstBlock->ptr2prevPhysBlock = NULL_PTR;
+    LOC_ptr2firstBlock->blockSize = MAMOS_HEAP_SIZE - MAMOS_HEAP_BLOCK_HEADER_SIZE;
+
+    LOC_ptr2endBlock = MAMOS_HEAP_NEXT_PHYS_BLOCK(LOC_ptr2firstBlock);
+    LOC_ptr2endBlock->ptr2prevPhysBlock = LOC_ptr2firstBlock;
+    LOC_ptr2endBlock->blockSize = 0;
+
+    MamOS_insertHeapBlock(LOC_ptr2firstBlock);
+    G_heapControl.minFreeSize = G_heapControl.freeSize;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_mapHeapBlockSize
+ * [Description]   : Maps a block size to its first and second level indices in the free lists matrix.
+ * [Arguments]     : <a_blockSize>        -> Indicates to the block size [in bytes].
+ *                   <a_ptr2firstLevel>   -> Pointer to a variable to store the first level index.
+ *                   <a_ptr2secondLevel>  -> Pointer to a variable to store the second level index.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_mapHeapBlockSize(uint32 a_blockSize, uint32* a_ptr2firstLevel, uint32* a_ptr2secondLevel)
+{
+    /* The small blocks are split linearly in the first level, The other blocks by powers of two in the first level,
+     * Then linearly in the second level. */
+    if(a_blockSize < MAMOS_HEAP_SMALL_BLOCK_SIZE)
+    {
+        *a_ptr2firstLevel = 0;
+        *a_ptr2secondLevel = a_blockSize >> MAMOS_HEAP_ALIGNMENT_LOG2;
+    }
+
+    else
+    {
+        uint32 LOC_lastSetBit = MAMOS_FIND_LAST_SET(a_blockSize);
+
+        *a_ptr2firstLevel = LOC_lastSetBit - (MAMOS_HEAP_FL_SHIFT - 1U);
+        *a_ptr2secondLevel = (a_blockSize >> (LOC_lastSetBit - MAMOS_HEAP_SL_COUNT_LOG2)) ^ MAMOS_HEAP_SL_COUNT;
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_insertHeapBlock
+ * [Description]   : Marks a specific block as free and inserts it at the head of its free list.
+ * [Arguments]     : <a_ptr2block>        -> Pointer to the required block.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_insertHeapBlock(MamOS_heapBlockType* a_ptr2block)
+{
+    uint32 LOC_firstLevel = 0;
+    uint32 LOC_secondLevel = 0;
+
+    MamOS_mapHeapBlockSize(a_ptr2block->blockSize, &LOC_firstLevel, &LOC_secondLevel);
+
+    a_ptr2block->ptr2prevFreeBlock = NULL_PTR;
+    a_ptr2block->ptr2nextFreeBlock = G_heapControl.freeLists[LOC_firstLevel][LOC_secondLevel];
+
+    if(a_ptr2block->ptr2nextFreeBlock != NULL_PTR)
+    {
+        a_ptr2block->ptr2nextFreeBlock->ptr2prevFreeBlock = a_ptr2block;
+    }
+
+    else
+    {
+        /* The free list was empty. */
+    }
+
+    G_heapControl.freeLists[LOC_firstLevel][LOC_secondLevel] = a_ptr2block;
+    G_heapControl.firstLevelBitmap |= (1UL << LOC_firstLevel);
+    G_heapControl.secondLevelBitmaps[LOC_firstLevel] |= (1UL << LOC_secondLevel);
+    G_heapControl.freeSize += a_ptr2block->blockSize;
+    G_heapControl.freeBlocks++;
+
+    a_ptr2block->blockSize |= MAMOS_HEAP_FREE_BLOCK;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_removeHeapBlock
+ * [Description]   : Removes a specific free block from its free list and marks it as used.
+ * [Arguments]     : <a_ptr2block>        -> Pointer to the required block.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_removeHeapBlock(MamOS_heapBlockType* a_ptr2block)
+{
+    uint32 LOC_firstLevel = 0;
+    uint32 LOC_secondLevel = 0;
+
+    a_ptr2block->blockSize &= ~MAMOS_HEAP_FREE_BLOCK;
+    MamOS_mapHeapBlockSize(a_ptr2block->blockSize, &LOC_firstLevel, &LOC_secondLevel);
+
+    if(a_ptr2block->ptr2nextFreeBlock != NULL_PTR)
+    {
+        a_ptr2block->ptr2nextFreeBlock->ptr2prevFreeBlock = a_ptr2block->ptr2prevFreeBlock;
+    }
+
+    else
+    {
+        /* The block is the last one in its free list. */
+    }
+
+    if(a_ptr2block->ptr2prevFreeBlock != NULL_PTR)
+    {
+        a_ptr2block->ptr2prevFreeBlock->ptr2nextFreeBlock = a_ptr2block->ptr2nextFreeBlock;
+    }
+
+    else
+    {
+        /* The block is the head of its free list, So the list bits are cleared once the list becomes empty. */
+        G_heapControl.freeLists[LOC_firstLevel][LOC_secondLevel] = a_ptr2block->ptr2nextFreeBlock;
+
+        if(a_ptr2block->ptr2nextFreeBlock == NULL_PTR)
+        {
+            G_heapControl.secondLevelBitmaps[LOC_firstLevel] &= ~(1UL << LOC_secondLevel);
+
+            if(G_heapControl.secondLevelBitmaps[LOC_firstLevel] == 0)
+            {
+                G_heapControl.firstLevelBitmap &= ~(1UL << LOC_firstLevel);
+            }
+        }
+    }
+
+    G_heapControl.freeSize -= a_ptr2block->blockSize;
+    G_heapControl.freeBlocks--;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeHeapMemory
+ * [Description]   : Takes a free block that fits a specific size from the MamOS heap and splits the rest of it
+ *                   [called inside a critical section].
+ * [Arguments]     : <a_size>             -> Indicates to the required memory size [in bytes].
+ * [return]        : The function returns the address of the taken memory [or Null Pointer if no block fits].
+ ====================================================================================================================*/
+static void* MamOS_takeHeapMemory(uint32 a_size)
+{
+    void* LOC_ptr2memory = NULL_PTR;
+    MamOS_heapBlockType* LOC_ptr2block = NULL_PTR;
+
+    if((a_size == 0) || (a_size > MAMOS_HEAP_SIZE))
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        uint32 LOC_blockSize = MAMOS_ALIGN_HEAP_SIZE(a_size + MAMOS_HEAP_BLOCK_HEADER_SIZE);
+        uint32 LOC_searchSize = 0;
+        uint32 LOC_firstLevel = 0;
+        uint32 LOC_secondLevel = 0;
+        uint32 LOC_secondLevelBitmap = 0;
+
+        if(LOC_blockSize < MAMOS_HEAP_MIN_BLOCK_SIZE)
+        {
+            LOC_blockSize = MAMOS_HEAP_MIN_BLOCK_SIZE;
+        }
+
+        /* Round the size up to the next free list, So any block in the found list fits without a list walk. */
+        LOC_searchSize = LOC_blockSize;
+
+        if(LOC_searchSize >= MAMOS_HEAP_SMALL_BLOCK_SIZE)
+        {
+            LOC_searchSize += (1UL << (MAMOS_FIND_LAST_SET(LOC_searchSize) - MAMOS_HEAP_SL_COUNT_LOG2)) - 1U;
+        }
+
+        MamOS_mapHeapBlockSize(LOC_searchSize, &LOC_firstLevel, &LOC_secondLevel);
+
+        /* Find the first non-empty free list at or above the mapped one [two bitmap searches]. */
+        if(LOC_firstLevel < MAMOS_HEAP_FL_COUNT)
+        {
+            LOC_secondLevelBitmap = G_heapControl.secondLevelBitmaps[LOC_firstLevel] & (0XFFFFFFFFUL << LOC_secondLevel);
+
+            if(LOC_secondLevelBitmap == 0)
+            {
+                uint32 LOC_firstLevelBitmap = G_heapControl.firstLevelBitmap & (0XFFFFFFFFUL << (LOC_firstLevel + 1U));
+
+                if(LOC_firstLevelBitmap != 0)
+                {
+                    LOC_firstLevel = MAMOS_FIND_FIRST_SET(LOC_firstLevelBitmap);
+                    LOC_secondLevelBitmap = G_heapControl.secondLevelBitmaps[LOC_firstLevel];
+                }
+            }
+
+            if(LOC_secondLevelBitmap != 0)
+            {
+                LOC_ptr2block = G_heapControl.freeLists[LOC_firstLevel][MAMOS_FIND_FIRST_SET(LOC_secondLevelBitmap)];
+            }
+        }
+
+        if(LOC_ptr2block != NULL_PTR)
+        {
+            MamOS_removeHeapBlock(LOC_ptr2block);
+
+            /* Split the rest of the block as a new free block if it's large enough to hold one. */
+            if((LOC_ptr2block->blockSize - LOC_blockSize) >= MAMOS_HEAP_MIN_BLOCK_SIZE)
+            {
+                MamOS_heapBlockType* LOC_ptr2restBlock = (MamOS_heapBlockType*)((uint8*)LOC_ptr2block + LOC_blockSize);
+
+                LOC_ptr2restBlock->ptr2prevPhysBlock = LOC_ptr2block;
+                LOC_ptr2restBlock->blockSize = LOC_ptr2block->blockSize - LOC_blockSize;
+                MAMOS_HEAP_NEXT_PHYS_BLOCK(LOC_ptr2restBlock)->ptr2prevPhysBlock = LOC_ptr2restBlock;
+                LOC_ptr2block->blockSize = LOC_blockSize;
+                MamOS_insertHeapBlock(LOC_ptr2restBlock);
+            }
+
+            if(G_heapControl.freeSize < G_heapControl.minFreeSize)
+            {
+                G_heapControl.minFreeSize = G_heapControl.freeSize;
+            }
+
+            LOC_ptr2memory = (uint8*)LOC_ptr2block + MAMOS_HEAP_BLOCK_HEADER_SIZE;
+        }
+    }
+
+    return LOC_ptr2memory;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_putHeapMemory
+ * [Description]   : Puts a memory block back to the MamOS heap after merging it with its free neighbours [called
+ *                   inside a critical section].
+ * [Arguments]     : <a_ptr2memory>       -> Pointer to the memory to be put back.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_putHeapMemory(void* a_ptr2memory)
+{
+    MamOS_heapBlockType* LOC_ptr2block = (MamOS_heapBlockType*)((uint8*)a_ptr2memory - MAMOS_HEAP_BLOCK_HEADER_SIZE);
+
+    if(((uint8*)a_ptr2memory <= (uint8*)G_heapRegion) || ((uint8*)a_ptr2memory >= ((uint8*)G_heapRegion + MAMOS_HEAP_SIZE)))
+    {
+        /* Invalid Operation. */
+    }
+
+    else if((LOC_ptr2block->blockSize & MAMOS_HEAP_FREE_BLOCK) != 0)
+    {
+        /* Invalid Operation [the block is already free]. */
+    }
+
+    else
+    {
+        MamOS_heapBlockType* LOC_ptr2nextBlock = MAMOS_HEAP_NEXT_PHYS_BLOCK(LOC_ptr2block);
+        MamOS_heapBlockType* LOC_ptr2prevBlock = LOC_ptr2block->ptr2prevPhysBlock;
+
+        /* Merge the block with its free neighbours at once, So two free blocks are never adjacent. */
+        if((LOC_ptr2nextBlock->blockSize & MAMOS_HEAP_FREE_BLOCK) != 0)
+        {
+            MamOS_removeHeapBlock(LOC_ptr2nextBlock);
+            LOC_ptr2block->blockSize += LOC_ptr2nextBlock->blockSize;
+        }
+
+        if((LOC_ptr2prevBlock != NULL_PTR) && ((LOC_ptr2prevBlock->blockSize & MAMOS_HEAP_FREE_BLOCK) != 0))
+        {
+            MamOS_removeHeapBlock(LOC_ptr2prevBlock);
+            LOC_ptr2prevBlock->blockSize += LOC_ptr2block->blockSize;
+            LOC_ptr2block = LOC_ptr2prevBlock;
+        }
+
+        MAMOS_HEAP_NEXT_PHYS_BLOCK(LOC_ptr2block)->ptr2prevPhysBlock = LOC_ptr2block;
+        MamOS_insertHeapBlock(LOC_ptr2block);
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_allocateMemoryCall
+ * [Description]   : Handles allocating memory from the MamOS heap [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the allocation request.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_allocateMemoryCall(void* a_ptr2argument)
+{
+    MamOS_heapRequestType* LOC_ptr2request = a_ptr2argument;
+
+    LOC_ptr2request->ptr2memory = MamOS_takeHeapMemory(LOC_ptr2request->size);
+
+    return 0;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_freeMemoryCall
+ * [Description]   : Handles freeing memory back to the MamOS heap [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the memory to be freed.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_freeMemoryCall(void* a_ptr2argument)
+{
+    MamOS_putHeapMemory(a_ptr2argument);
+
+    return 0;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getLargestFreeBlockCall
+ * [Description]   : Handles finding the largest free block in the MamOS heap [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Not used.
+ * [return]        : The function returns the largest free block size [in bytes].
+ ====================================================================================================================*/
+static uint32 MamOS_getLargestFreeBlockCall(void* a_ptr2argument)
+{
+    uint32 LOC_largestSize = 0;
+
+    /* The largest block is in the highest non-empty free list, So only that list is walked. */
+    if(G_heapControl.firstLevelBitmap != 0)
+    {
+        uint32 LOC_firstLevel = MAMOS_FIND_LAST_SET(G_heapControl.firstLevelBitmap);
+        uint32 LOC_secondLevel = MAMOS_FIND_LAST_SET(G_heapControl.secondLevelBitmaps[LOC_firstLevel]);
+
+        for(MamOS_heapBlockType* LOC_ptr2block = G_heapControl.freeLists[LOC_firstLevel][LOC_secondLevel]; LOC_ptr2block != NULL_PTR; LOC_ptr2block = LOC_ptr2block->ptr2nextFreeBlock)
+        {
+            if(MAMOS_HEAP_BLOCK_SIZE(LOC_ptr2block) > LOC_largestSize)
+            {
+                LOC_largestSize = MAMOS_HEAP_BLOCK_SIZE(LOC_ptr2block);
+            }
+        }
+
+        LOC_largestSize -= MAMOS_HEAP_BLOCK_HEADER_SIZE;
+    }
+
+    return LOC_largestSize;
 }
@@ -0,0 +1,67 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Message Queue
+File Name    : message_queue.h
+Date Created : Oct 17, 2026
+Description  : Interface file for the MamOS Message Queue module.
+=======================================================================================================================
+*/
+
+
+#ifndef MAMOS_MESSAGEQUEUE_INCLUDES_MESSAGE_QUEUE_H_
+#define MAMOS_MESSAGEQUEUE_INCLUDES_MESSAGE_QUEUE_H_
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createMessageQueue
+ * [Description]   : Creates a new message queue of fixed-size items in the MamOS.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the message queue [supplied by the
+ *                                           user, at least item size times capacity bytes].
+ *                   <a_itemSize>         -> Indicates to the size of a single item [in bytes].
+ *                   <a_capacity>         -> Indicates to the maximum number of items in the message queue.
+ * [return]        : The function returns the handle to the created message queue [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_messageQueueHandle MamOS_createMessageQueue(uint8* a_ptr2storage, uint16 a_itemSize, uint16 a_capacity);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_sendToMessageQueue
+ * [Description]   : Sends an item to a specific message queue, The item is copied directly to the highest priority
+ *                   waiting receiver [if any], Otherwise it's stored in the message queue. The task is blocked
+ *                   while the message queue is full until a slot is freed or the timeout expires.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to the item to be sent.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_sendToMessageQueue(MamOS_messageQueueHandle a_ptr2messageQueue, const void* a_ptr2item, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_sendToMessageQueueFromISR
+ * [Description]   : Sends an item to a specific message queue from an interrupt without blocking, The context
+ *                   switch to the woken receiver task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to the item to be sent.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    receiver task precedes the task going to run next.
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the message queue is full.
+ ====================================================================================================================*/
+uint8 MamOS_sendToMessageQueueFromISR(MamOS_messageQueueHandle a_ptr2messageQueue, const void* a_ptr2item, uint8* a_ptr2higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_receiveFromMessageQueue
+ * [Description]   : Receives the oldest item from a specific message queue, The task is blocked while the message
+ *                   queue is empty until an item is sent or the timeout expires.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to a buffer to store the received item.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if an item is received, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_receiveFromMessageQueue(MamOS_messageQueueHandle a_ptr2messageQueue, void* a_ptr2item, uint32 a_timeoutTicks);
+
+#endif /* MAMOS_MESSAGEQUEUE_INCLUDES_MESSAGE_QUEUE_H_ */
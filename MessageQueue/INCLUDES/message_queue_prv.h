@@ -0,0 +1,69 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Message Queue
+File Name    : message_queue_prv.h
+Date Created : Oct 17, 2026
+Description  : Private file for the MamOS Message Queue module.
+=======================================================================================================================
+*/
+
+
+#ifndef MAMOS_MESSAGEQUEUE_INCLUDES_MESSAGE_QUEUE_PRV_H_
+#define MAMOS_MESSAGEQUEUE_INCLUDES_MESSAGE_QUEUE_PRV_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+typedef struct
+{
+    MamOS_messageQueueHandle ptr2messageQueue;              /* The required message queue.                           */
+    void* ptr2item;                                         /* The item to be sent or the buffer to receive it.      */
+    uint32 timeoutTicks;                                    /* Maximum waiting time [in ticks].                      */
+}MamOS_messageRequestType;
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_copyMessageItem
+ * [Description]   : Copies a single item of a message queue from a buffer to another.
+ * [Arguments]     : <a_ptr2destination>  -> Pointer to the destination buffer.
+ *                   <a_ptr2source>       -> Pointer to the source buffer.
+ *                   <a_itemSize>         -> Indicates to the item size [in bytes].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_copyMessageItem(uint8* a_ptr2destination, const uint8* a_ptr2source, uint16 a_itemSize);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_putMessageItem
+ * [Description]   : Sends an item without blocking, Directly to the highest priority waiting receiver [if any] or
+ *                   into the storage buffer [called inside a critical section].
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to the item to be sent.
+ *                   <a_ptr2wokenTask>    -> Pointer to a variable to store the woken receiver task [if any].
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the message queue is full.
+ ====================================================================================================================*/
+static uint8 MamOS_putMessageItem(MamOS_messageQueueHandle a_ptr2messageQueue, const uint8* a_ptr2item, MamOS_taskControlBlockType** a_ptr2wokenTask);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_sendMessageCall
+ * [Description]   : Handles sending an item to a specific message queue [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the send request.
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the message queue is full, Or
+ *                   pending if the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_sendMessageCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_receiveMessageCall
+ * [Description]   : Handles receiving an item from a specific message queue [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the receive request.
+ * [return]        : The function returns TRUE if an item is received, FALSE if the message queue is empty, Or
+ *                   pending if the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_receiveMessageCall(void* a_ptr2argument);
+
+#endif /* MAMOS_MESSAGEQUEUE_INCLUDES_MESSAGE_QUEUE_PRV_H_ */
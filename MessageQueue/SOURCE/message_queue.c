@@ -0,0 +1,320 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Message Queue
+File Name    : message_queue.c
+Date Created : Oct 17, 2026
+Description  : Source file for the MamOS Message Queue module.
+=======================================================================================================================
+*/
+
+
+/*=====================================================================================================================
+ * [Details]     : This module hosts the message queues of the MamOS, They pass fixed-size items between tasks
+ *                 [and from interrupts to tasks] by copy. The blocked senders and receivers wait in priority
+ *                 ordered waiting queues with an optional timeout. An item sent while a receiver is waiting is
+ *                 copied directly to the receiver buffer, So it's never copied through the storage buffer.
+ ====================================================================================================================*/
+
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+#include "../../Others/std_types.h"
+#include "../../Others/kernel_defs.h"
+#include "../../Queue/INCLUDES/queue.h"
+#include "../../Scheduler/INCLUDES/scheduler.h"
+#include "../../Core/INCLUDES/core.h"
+#include "../INCLUDES/message_queue_prv.h"
+#include "../INCLUDES/message_queue.h"
+
+/*=====================================================================================================================
+                                           < Global Variables >
+=====================================================================================================================*/
+
+/* Array of message queues that available in the system. */
+volatile MamOS_messageQueueType G_messageQueueHeap[MAMOS_MAX_NUM_OF_MESSAGE_QUEUES] = {0};
+
+/* Extern the Kernel Control Panel. */
+extern MamOS_kernelControlPanelType G_kernelControlPanel;
+
+/*=====================================================================================================================
+                                          < Functions Definitions >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createMessageQueue
+ * [Description]   : Creates a new message queue of fixed-size items in the MamOS.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the message queue [supplied by the
+ *                                           user, at least item size times capacity bytes].
+ *                   <a_itemSize>         -> Indicates to the size of a single item [in bytes].
+ *                   <a_capacity>         -> Indicates to the maximum number of items in the message queue.
+ * [return]        : The function returns the handle to the created message queue [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_messageQueueHandle MamOS_createMessageQueue(uint8* a_ptr2storage, uint16 a_itemSize, uint16 a_capacity)
+{
+    MamOS_messageQueueHandle LOC_createdMessageQueueHandle = NULL_PTR;
+
+    if(G_kernelControlPanel.messageQueueCounter >= MAMOS_MAX_NUM_OF_MESSAGE_QUEUES)
+    {
+        /* Invalid Operation. */
+    }
+
+    else if(a_ptr2storage == NULL_PTR)
+    {
+        /* Invalid Operation. */
+    }
+
+    else if((a_itemSize == 0) || (a_capacity == 0))
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        /* Get the handle of the created message queue and increment the message queue counter. */
+        LOC_createdMessageQueueHandle = &G_messageQueueHeap[G_kernelControlPanel.messageQueueCounter];
+        G_kernelControlPanel.messageQueueCounter++;
+
+        /* Initialize the new message queue. */
+        LOC_createdMessageQueueHandle->ptr2storage = a_ptr2storage;
+        LOC_createdMessageQueueHandle->itemSize = a_itemSize;
+        LOC_createdMessageQueueHandle->capacity = a_capacity;
+        LOC_createdMessageQueueHandle->itemsCount = 0;
+        LOC_createdMessageQueueHandle->readSlot = 0;
+        LOC_createdMessageQueueHandle->writeSlot = 0;
+        LOC_createdMessageQueueHandle->sendersQueue.queueSize = 0;
+        LOC_createdMessageQueueHandle->sendersQueue.ptr2headTask = NULL_PTR;
+        LOC_createdMessageQueueHandle->sendersQueue.ptr2rearTask = NULL_PTR;
+        LOC_createdMessageQueueHandle->receiversQueue.queueSize = 0;
+        LOC_createdMessageQueueHandle->receiversQueue.ptr2headTask = NULL_PTR;
+        LOC_createdMessageQueueHandle->receiversQueue.ptr2rearTask = NULL_PTR;
+    }
+
+    return LOC_createdMessageQueueHandle;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_sendToMessageQueue
+ * [Description]   : Sends an item to a specific message queue, The item is copied directly to the highest priority
+ *                   waiting receiver [if any], Otherwise it's stored in the message queue. The task is blocked
+ *                   while the message queue is full until a slot is freed or the timeout expires.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to the item to be sent.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_sendToMessageQueue(MamOS_messageQueueHandle a_ptr2messageQueue, const void* a_ptr2item, uint32 a_timeoutTicks)
+{
+    uint32 LOC_result = FALSE;
+    MamOS_messageRequestType LOC_request = {a_ptr2messageQueue, (void*)a_ptr2item, a_timeoutTicks};
+
+    LOC_result = MamOS_kernelCall(MamOS_sendMessageCall, &LOC_request);
+
+    /* The task was blocked, So the result is known only after a receiver takes the item or the timeout expires. */
+    if(LOC_result == MAMOS_WAIT_RESULT_PENDING)
+    {
+        LOC_result = G_kernelControlPanel.ptr2activeTask->waitResult;
+    }
+
+    return (uint8)LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_sendToMessageQueueFromISR
+ * [Description]   : Sends an item to a specific message queue from an interrupt without blocking, The context
+ *                   switch to the woken receiver task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to the item to be sent.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    receiver task precedes the task going to run next.
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the message queue is full.
+ ====================================================================================================================*/
+uint8 MamOS_sendToMessageQueueFromISR(MamOS_messageQueueHandle a_ptr2messageQueue, const void* a_ptr2item, uint8* a_ptr2higherPriorityTaskWoken)
+{
+    uint8 LOC_result = FALSE;
+    MamOS_taskControlBlockType* LOC_ptr2wokenTask = NULL_PTR;
+
+    MamOS_enterCritical();
+
+    LOC_result = MamOS_putMessageItem(a_ptr2messageQueue, a_ptr2item, &LOC_ptr2wokenTask);
+
+    if((LOC_ptr2wokenTask != NULL_PTR) && (a_ptr2higherPriorityTaskWoken != NULL_PTR))
+    {
+        if(MamOS_isTaskPreceding(LOC_ptr2wokenTask, G_kernelControlPanel.ptr2standbyTask) == TRUE)
+        {
+            *a_ptr2higherPriorityTaskWoken = TRUE;
+        }
+    }
+
+    MamOS_exitCritical();
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_receiveFromMessageQueue
+ * [Description]   : Receives the oldest item from a specific message queue, The task is blocked while the message
+ *                   queue is empty until an item is sent or the timeout expires.
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to a buffer to store the received item.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if an item is received, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_receiveFromMessageQueue(MamOS_messageQueueHandle a_ptr2messageQueue, void* a_ptr2item, uint32 a_timeoutTicks)
+{
+    uint32 LOC_result = FALSE;
+    MamOS_messageRequestType LOC_request = {a_ptr2messageQueue, a_ptr2item, a_timeoutTicks};
+
+    LOC_result = MamOS_kernelCall(MamOS_receiveMessageCall, &LOC_request);
+
+    /* The task was blocked, So the result is known only after a sender delivers an item or the timeout expires. */
+    if(LOC_result == MAMOS_WAIT_RESULT_PENDING)
+    {
+        LOC_result = G_kernelControlPanel.ptr2activeTask->waitResult;
+    }
+
+    return (uint8)LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_copyMessageItem
+ * [Description]   : Copies a single item of a message queue from a buffer to another.
+ * [Arguments]     : <a_ptr2destination>  -> Pointer to the destination buffer.
+ *                   <a_ptr2source>       -> Pointer to the source buffer.
+ *                   <a_itemSize>         -> Indicates to the item size [in bytes].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_copyMessageItem(uint8* a_ptr2destination, const uint8* a_ptr2source, uint16 a_itemSize)
+{
+    for(uint16 counter = 0; counter < a_itemSize; counter++)
+    {
+        a_ptr2destination[counter] = a_ptr2source[counter];
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_putMessageItem
+ * [Description]   : Sends an item without blocking, Directly to the highest priority waiting receiver [if any] or
+ *                   into the storage buffer [called inside a critical section].
+ * [Arguments]     : <a_ptr2messageQueue> -> Pointer to the required message queue.
+ *                   <a_ptr2item>         -> Pointer to the item to be sent.
+ *                   <a_ptr2wokenTask>    -> Pointer to a variable to store the woken receiver task [if any].
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the message queue is full.
+ ====================================================================================================================*/
+static uint8 MamOS_putMessageItem(MamOS_messageQueueHandle a_ptr2messageQueue, const uint8* a_ptr2item, MamOS_taskControlBlockType** a_ptr2wokenTask)
+{
+    uint8 LOC_result = TRUE;
+    MamOS_taskControlBlockType* LOC_ptr2receiverTask = a_ptr2messageQueue->receiversQueue.ptr2headTask;
+
+    /* Receivers wait only while the storage buffer is empty, So the item is handed over directly. */
+    if(LOC_ptr2receiverTask != NULL_PTR)
+    {
+        MamOS_copyMessageItem(LOC_ptr2receiverTask->ptr2waitingData, a_ptr2item, a_ptr2messageQueue->itemSize);
+        MamOS_wakeFromWaitingQueue(LOC_ptr2receiverTask);
+        *a_ptr2wokenTask = LOC_ptr2receiverTask;
+    }
+
+    else if(a_ptr2messageQueue->itemsCount < a_ptr2messageQueue->capacity)
+    {
+        MamOS_copyMessageItem(&a_ptr2messageQueue->ptr2storage[a_ptr2messageQueue->writeSlot * a_ptr2messageQueue->itemSize], a_ptr2item, a_ptr2messageQueue->itemSize);
+        a_ptr2messageQueue->writeSlot = (a_ptr2messageQueue->writeSlot + 1 == a_ptr2messageQueue->capacity) ? 0 : a_ptr2messageQueue->writeSlot + 1;
+        a_ptr2messageQueue->itemsCount++;
+    }
+
+    else
+    {
+        LOC_result = FALSE;
+    }
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_sendMessageCall
+ * [Description]   : Handles sending an item to a specific message queue [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the send request.
+ * [return]        : The function returns TRUE if the item is sent, FALSE if the message queue is full, Or
+ *                   pending if the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_sendMessageCall(void* a_ptr2argument)
+{
+    uint32 LOC_result = TRUE;
+    MamOS_messageRequestType* LOC_ptr2request = a_ptr2argument;
+    MamOS_taskControlBlockType* LOC_ptr2wokenTask = NULL_PTR;
+
+    if(MamOS_putMessageItem(LOC_ptr2request->ptr2messageQueue, LOC_ptr2request->ptr2item, &LOC_ptr2wokenTask) == TRUE)
+    {
+        if(LOC_ptr2wokenTask != NULL_PTR)
+        {
+            MamOS_yieldFromISR(MamOS_isTaskPreceding(LOC_ptr2wokenTask, G_kernelControlPanel.ptr2standbyTask));
+        }
+    }
+
+    else if(LOC_ptr2request->timeoutTicks == 0)
+    {
+        LOC_result = FALSE;
+    }
+
+    else
+    {
+        /* Block the sender with its item, So a receiver moves it into the storage buffer when a slot is freed. */
+        G_kernelControlPanel.ptr2activeTask->ptr2waitingData = LOC_ptr2request->ptr2item;
+        MamOS_addToWaitingQueue(&LOC_ptr2request->ptr2messageQueue->sendersQueue, G_kernelControlPanel.ptr2activeTask, LOC_ptr2request->timeoutTicks);
+        MamOS_forceTaskTransition();
+        LOC_result = MAMOS_WAIT_RESULT_PENDING;
+    }
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_receiveMessageCall
+ * [Description]   : Handles receiving an item from a specific message queue [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the receive request.
+ * [return]        : The function returns TRUE if an item is received, FALSE if the message queue is empty, Or
+ *                   pending if the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_receiveMessageCall(void* a_ptr2argument)
+{
+    uint32 LOC_result = TRUE;
+    MamOS_messageRequestType* LOC_ptr2request = a_ptr2argument;
+    MamOS_messageQueueHandle LOC_ptr2messageQueue = LOC_ptr2request->ptr2messageQueue;
+
+    if(LOC_ptr2messageQueue->itemsCount != 0)
+    {
+        MamOS_taskControlBlockType* LOC_ptr2senderTask = LOC_ptr2messageQueue->sendersQueue.ptr2headTask;
+
+        MamOS_copyMessageItem(LOC_ptr2request->ptr2item, &LOC_ptr2messageQueue->ptr2storage[LOC_ptr2messageQueue->readSlot * LOC_ptr2messageQueue->itemSize], LOC_ptr2messageQueue->itemSize);
+        LOC_ptr2messageQueue->readSlot = (LOC_ptr2messageQueue->readSlot + 1 == LOC_ptr2messageQueue->capacity) ? 0 : LOC_ptr2messageQueue->readSlot + 1;
+        LOC_ptr2messageQueue->itemsCount--;
+
+        /* Move the item of the highest priority waiting sender into the freed slot, Then wake the sender up. */
+        if(LOC_ptr2senderTask != NULL_PTR)
+        {
+            MamOS_copyMessageItem(&LOC_ptr2messageQueue->ptr2storage[LOC_ptr2messageQueue->writeSlot * LOC_ptr2messageQueue->itemSize], LOC_ptr2senderTask->ptr2waitingData, LOC_ptr2messageQueue->itemSize);
+            LOC_ptr2messageQueue->writeSlot = (LOC_ptr2messageQueue->writeSlot + 1 == LOC_ptr2messageQueue->capacity) ? 0 : LOC_ptr2messageQueue->writeSlot + 1;
+            LOC_ptr2messageQueue->itemsCount++;
+            MamOS_wakeFromWaitingQueue(LOC_ptr2senderTask);
+            MamOS_yieldFromISR(MamOS_isTaskPreceding(LOC_ptr2senderTask, G_kernelControlPanel.ptr2standbyTask));
+        }
+    }
+
+    else if(LOC_ptr2request->timeoutTicks == 0)
+    {
+        LOC_result = FALSE;
+    }
+
+    else
+    {
+        /* Block the receiver with its buffer, So a sender copies the next item directly into it. */
+        G_kernelControlPanel.ptr2activeTask->ptr2waitingData = LOC_ptr2request->ptr2item;
+        MamOS_addToWaitingQueue(&LOC_ptr2messageQueue->receiversQueue, G_kernelControlPanel.ptr2activeTask, LOC_ptr2request->timeoutTicks);
+        MamOS_forceTaskTransition();
+        LOC_result = MAMOS_WAIT_RESULT_PENDING;
+    }
+
+    return LOC_result;
+}
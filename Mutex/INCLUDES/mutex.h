@@ -18,11 +18,13 @@ Description  : Interface file for the MamOS Mutex module.
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_createMutex
- * [Description]   : reates a new mutex in the MamOS.
- * [Arguments]     : The function Takes no arguments.
+ * [Description]   : Creates a new mutex in the MamOS, The mutex either raises its owner to a ceiling priority as
+ *                   soon as it's acquired [immediate priority ceiling], Or uses priority inheritance.
+ * [Arguments]     : <a_ceilingPriority> -> Indicates to the priority of the highest priority task that acquires
+ *                                          the mutex, Or MAMOS_NO_PRIORITY_CEILING for priority inheritance.
  * [return]        : The function returns the handle to the created mutex [or Null Pointer if creation fails].
  ====================================================================================================================*/
-MamOS_mutexHandle MamOS_createMutex(void);
+MamOS_mutexHandle MamOS_createMutex(uint8 a_ceilingPriority);
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_acquireMutex
@@ -40,4 +42,24 @@ void MamOS_acquireMutex(MamOS_mutexHandle a_ptr2mutex);
  ====================================================================================================================*/
 void MamOS_releaseMutex(MamOS_mutexHandle a_ptr2mutex);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_releaseTaskMutexes
+ * [Description]   : Releases the mutexes of a task being deleted, Each mutex it owns is handed over to its waiting
+ *                   tasks, And the owners of the mutex it waits for drop the priority they inherited from it
+ *                   [called inside a kernel call after the task is unlinked from its waiting queue].
+ * [Arguments]     : <a_ptr2task>       -> Pointer to the task being deleted.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_releaseTaskMutexes(MamOS_taskControlBlockType* a_ptr2task);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_leaveBlockingMutex
+ * [Description]   : Stops a task from waiting for its blocking mutex, The owners it lent its priority to drop the
+ *                   priority they inherited from it [called inside a kernel call after the task is unlinked from
+ *                   its waiting queue].
+ * [Arguments]     : <a_ptr2task>       -> Pointer to the task that stops waiting.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_leaveBlockingMutex(MamOS_taskControlBlockType* a_ptr2task);
+
 #endif /* MAMOS_MUTEX_INCLUDES_MUTEX_H_ */
@@ -12,10 +12,70 @@ Description  : Private file for the MamOS Mutex module.
 #ifndef MAMOS_MUTEX_INCLUDES_MUTEX_PRV_H_
 #define MAMOS_MUTEX_INCLUDES_MUTEX_PRV_H_
 
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Gets the owner task of a specific mutex from its lock word [the task control blocks are word aligned]. */
+#define MAMOS_MUTEX_OWNER(MUTEX)              ((MamOS_taskControlBlockType*)((MUTEX)->lockWord & ~MAMOS_MUTEX_KERNEL_FLAG))
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_swapMutexLockWord
+ * [Description]   : Swaps the lock word of a specific mutex atomically with LDREX/STREX, If it equals an expected
+ *                   value [runs in thread mode without entering the kernel].
+ * [Arguments]     : <a_ptr2mutex>      -> Pointer to the required mutex.
+ *                   <a_expectedWord>   -> Indicates to the expected value of the lock word.
+ *                   <a_newWord>        -> Indicates to the new value of the lock word.
+ * [return]        : The function returns TRUE if the lock word is swapped, FALSE if it differs from the expected.
+ ====================================================================================================================*/
+static uint8 MamOS_swapMutexLockWord(MamOS_mutexHandle a_ptr2mutex, uint32 a_expectedWord, uint32 a_newWord);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_acquireMutexCall
+ * [Description]   : Handles the acquisition of a specific mutex [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>   -> Pointer to the required mutex.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_acquireMutexCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_releaseMutexCall
+ * [Description]   : Handles the release operation of a specific mutex [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>   -> Pointer to the required mutex.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_releaseMutexCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_handOverMutex
+ * [Description]   : Hands a specific mutex over to the highest priority task waiting for it, Or unlocks it if no
+ *                   task waits for it [called inside a kernel call].
+ * [Arguments]     : <a_ptr2mutex>      -> Pointer to the required mutex.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_handOverMutex(MamOS_mutexHandle a_ptr2mutex);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_inheritMutexPriority
+ * [Description]   : Raises the priority of the owner of a specific mutex to the priority of a waiting task, Then
+ *                   the owners of the mutexes that each boosted owner waits for [transitive inheritance].
+ * [Arguments]     : <a_ptr2mutex>      -> Pointer to the mutex that the task waits for.
+ *                   <a_priority>       -> Indicates to the priority of the waiting task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_inheritMutexPriority(MamOS_mutexHandle a_ptr2mutex, uint8 a_priority);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_restoreOwnerPriority
+ * [Description]   : Recalculates the priority of a specific task from its base priority, The ceiling of each
+ *                   mutex it still holds, and the highest priority task waiting for each of them.
+ * [Arguments]     : <a_ptr2ownerTask>  -> Pointer to the required task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_restoreOwnerPriority(MamOS_taskControlBlockType* a_ptr2ownerTask);
 
 #endif /* MAMOS_MUTEX_INCLUDES_MUTEX_PRV_H_ */
@@ -12,8 +12,14 @@ Description  : Source file for the MamOS Mutex module.
 /*=====================================================================================================================
  * [Details]     : This module hosts the functionality of the MamOS Mutex system, including mutex creation,
  *                 acquisition, and release operations. Mutexes are used for task synchronization
- *                 and protecting shared resources in the MamOS.
- * [Future Work] : Support priority inheritance to solve the priority inversion problem.
+ *                 and protecting shared resources in the MamOS. The owner of a mutex inherits the priority of
+ *                 its highest priority waiting task [through the whole chain of owners], So the priority
+ *                 inversion is bounded by the critical sections of the lower priority owners. A mutex with a
+ *                 priority ceiling raises its owner to the ceiling once acquired instead, So none of the tasks
+ *                 that share it can preempt the owner, and the mutex is never contended.
+ *                 An uncontended mutex with priority inheritance is acquired and released in thread mode by an
+ *                 atomic swap of its lock word [LDREX/STREX], So the kernel is entered only to wait for a locked
+ *                 mutex, And to release a mutex that the kernel tracks [had waiters or has a ceiling].
  ====================================================================================================================*/
 
 /*=====================================================================================================================
@@ -23,6 +29,8 @@ Description  : Source file for the MamOS Mutex module.
 #include "../../Others/std_types.h"
 #include "../../Others/kernel_defs.h"
 #include "../../Queue/INCLUDES/queue.h"
+#include "../../Scheduler/INCLUDES/scheduler.h"
+#include "../../Core/INCLUDES/core.h"
 #include "../INCLUDES/mutex_prv.h"
 #include "../INCLUDES/mutex.h"
 
@@ -42,11 +50,13 @@ extern MamOS_kernelControlPanelType G_kernelControlPanel;
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_createMutex
- * [Description]   : reates a new mutex in the MamOS.
- * [Arguments]     : The function Takes no arguments.
+ * [Description]   : Creates a new mutex in the MamOS, The mutex either raises its owner to a ceiling priority as
+ *                   soon as it's acquired [immediate priority ceiling], Or uses priority inheritance.
+ * [Arguments]     : <a_ceilingPriority> -> Indicates to the priority of the highest priority task that acquires
+ *                                          the mutex, Or MAMOS_NO_PRIORITY_CEILING for priority inheritance.
  * [return]        : The function returns the handle to the created mutex [or Null Pointer if creation fails].
  ====================================================================================================================*/
-MamOS_mutexHandle MamOS_createMutex(void)
+MamOS_mutexHandle MamOS_createMutex(uint8 a_ceilingPriority)
 {
     MamOS_mutexHandle LOC_createdMutexHandle = NULL_PTR;
 
@@ -59,8 +69,9 @@ MamOS_mutexHandle MamOS_createMutex(void)
         /* Initialize the new mutex. */
         LOC_createdMutexHandle->waitingQueue.ptr2headTask = NULL_PTR;
         LOC_createdMutexHandle->waitingQueue.ptr2rearTask = NULL_PTR;
-        LOC_createdMutexHandle->mutexState = MAMOS_MUTEX_UNLOCKED;
-        LOC_createdMutexHandle->ptr2ownerTask = NULL_PTR;
+        LOC_createdMutexHandle->lockWord = MAMOS_MUTEX_UNLOCKED;
+        LOC_createdMutexHandle->ptr2nextHeldMutex = NULL_PTR;
+        LOC_createdMutexHandle->ceilingPriority = a_ceilingPriority;
     }
 
     else
@@ -79,19 +90,21 @@ MamOS_mutexHandle MamOS_createMutex(void)
  ====================================================================================================================*/
 void MamOS_acquireMutex(MamOS_mutexHandle a_ptr2mutex)
 {
-    /* check if the mutex is available or locked by another task. */
-    if(a_ptr2mutex->mutexState == MAMOS_MUTEX_UNLOCKED)
+    /* Lock an available mutex in thread mode, The kernel is only entered to wait for a locked mutex or to raise
+     * the owner priority to the mutex ceiling. */
+    if((a_ptr2mutex->ceilingPriority != MAMOS_NO_PRIORITY_CEILING) ||
+       (MamOS_swapMutexLockWord(a_ptr2mutex, MAMOS_MUTEX_UNLOCKED, (uint32)G_kernelControlPanel.ptr2activeTask) == FALSE))
     {
-        /* If available, Lock it and change the ownership of the mutex the calling task. */
-        a_ptr2mutex->ptr2ownerTask = G_kernelControlPanel.ptr2activeTask;
-        a_ptr2mutex->mutexState = MAMOS_MUTEX_LOCKED;
+        /* A waiting task that was suspended is resumed without the mutex, So it waits for it again. */
+        do
+        {
+            MamOS_kernelCall(MamOS_acquireMutexCall, a_ptr2mutex);
+        }while(MAMOS_MUTEX_OWNER(a_ptr2mutex) != G_kernelControlPanel.ptr2activeTask);
     }
 
     else
     {
-        /* If locked, Add the current task to this mutex waiting queue and request a context switch. */
-        MamOS_addToWaitingQueue(a_ptr2mutex, G_kernelControlPanel.ptr2activeTask);
-        MAMOS_TASK_TRANS_REQUEST();
+        /* The mutex is acquired without entering the kernel. */
     }
 }
 
@@ -103,27 +116,298 @@ void MamOS_acquireMutex(MamOS_mutexHandle a_ptr2mutex)
  ====================================================================================================================*/
 void MamOS_releaseMutex(MamOS_mutexHandle a_ptr2mutex)
 {
+    /* The lock word holds the owner alone only if the kernel never tracked the mutex, So there is no waiting task
+     * to hand it over to, Otherwise [or if the calling task isn't the owner] the release enters the kernel. */
+    if(MamOS_swapMutexLockWord(a_ptr2mutex, (uint32)G_kernelControlPanel.ptr2activeTask, MAMOS_MUTEX_UNLOCKED) == FALSE)
+    {
+        MamOS_kernelCall(MamOS_releaseMutexCall, a_ptr2mutex);
+    }
+
+    else
+    {
+        /* The mutex is released without entering the kernel. */
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_swapMutexLockWord
+ * [Description]   : Swaps the lock word of a specific mutex atomically with LDREX/STREX, If it equals an expected
+ *                   value [runs in thread mode without entering the kernel].
+ * [Arguments]     : <a_ptr2mutex>      -> Pointer to the required mutex.
+ *                   <a_expectedWord>   -> Indicates to the expected value of the lock word.
+ *                   <a_newWord>        -> Indicates to the new value of the lock word.
+ * [return]        : The function returns TRUE if the lock word is swapped, FALSE if it differs from the expected.
+ ====================================================================================================================*/
+static uint8 MamOS_swapMutexLockWord(MamOS_mutexHandle a_ptr2mutex, uint32 a_expectedWord, uint32 a_newWord)
+{
+    uint8 LOC_result = FALSE;
+    uint32 LOC_lockWord = 0;
+    uint32 LOC_storeFailed = 0;
+
+    MAMOS_MEMORY_BARRIER();
+
+    /* Any exception between the exclusive load and store clears the exclusive monitor and fails the store [even
+     * a kernel call that changed the lock word], So the swap is retried until it's stored or the word differs. */
+    do
+    {
+        __asm__ volatile ("LDREX %0, [%1]" : "=r" (LOC_lockWord) : "r" (&a_ptr2mutex->lockWord) : "memory");
+
+        if(LOC_lockWord == a_expectedWord)
+        {
+            __asm__ volatile ("STREX %0, %2, [%1]" : "=&r" (LOC_storeFailed) : "r" (&a_ptr2mutex->lockWord), "r" (a_newWord) : "memory");
+            LOC_result = (LOC_storeFailed == 0) ? TRUE : FALSE;
+        }
+
+        else
+        {
+            __asm__ volatile ("CLREX" ::: "memory");
+            LOC_storeFailed = 0;
+        }
+    }while(LOC_storeFailed != 0);
+
+    MAMOS_MEMORY_BARRIER();
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_acquireMutexCall
+ * [Description]   : Handles the acquisition of a specific mutex [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>   -> Pointer to the required mutex.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_acquireMutexCall(void* a_ptr2argument)
+{
+    MamOS_mutexHandle LOC_ptr2mutex = a_ptr2argument;
+
+    /* check if the mutex is available or locked by another task. */
+    if(LOC_ptr2mutex->lockWord == MAMOS_MUTEX_UNLOCKED)
+    {
+        /* If available, Lock it and change the ownership of the mutex the calling task [tracked by the kernel]. */
+        LOC_ptr2mutex->lockWord = (uint32)G_kernelControlPanel.ptr2activeTask | MAMOS_MUTEX_KERNEL_FLAG;
+        LOC_ptr2mutex->ptr2nextHeldMutex = G_kernelControlPanel.ptr2activeTask->ptr2heldMutexes;
+        G_kernelControlPanel.ptr2activeTask->ptr2heldMutexes = LOC_ptr2mutex;
+
+        /* Raise the owner to the mutex ceiling at once, So no other task that shares the mutex can preempt it. */
+        if(LOC_ptr2mutex->ceilingPriority < G_kernelControlPanel.ptr2activeTask->priority)
+        {
+            MamOS_changeTaskPriority(G_kernelControlPanel.ptr2activeTask, LOC_ptr2mutex->ceilingPriority);
+        }
+    }
+
+    else
+    {
+        /* A mutex locked in thread mode isn't linked to the held mutexes of its owner, So link it now that the owner
+         * inherits priority through it, And flag it to force its release through the kernel. */
+        if((LOC_ptr2mutex->lockWord & MAMOS_MUTEX_KERNEL_FLAG) == 0)
+        {
+            MamOS_taskControlBlockType* LOC_ptr2ownerTask = MAMOS_MUTEX_OWNER(LOC_ptr2mutex);
+
+            LOC_ptr2mutex->ptr2nextHeldMutex = LOC_ptr2ownerTask->ptr2heldMutexes;
+            LOC_ptr2ownerTask->ptr2heldMutexes = LOC_ptr2mutex;
+            LOC_ptr2mutex->lockWord |= MAMOS_MUTEX_KERNEL_FLAG;
+        }
+
+        /* If locked, Add the current task to this mutex waiting queue and switch to another task [the kernel call
+         * already runs in handler mode, So the task transition is called directly instead of requesting it]. */
+        G_kernelControlPanel.ptr2activeTask->ptr2blockingMutex = LOC_ptr2mutex;
+        MamOS_addToWaitingQueue(&LOC_ptr2mutex->waitingQueue, G_kernelControlPanel.ptr2activeTask, MAMOS_WAIT_FOREVER);
+        MamOS_inheritMutexPriority(LOC_ptr2mutex, G_kernelControlPanel.ptr2activeTask->priority);
+        MamOS_forceTaskTransition();
+    }
+
+    return 0;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_releaseMutexCall
+ * [Description]   : Handles the release operation of a specific mutex [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>   -> Pointer to the required mutex.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_releaseMutexCall(void* a_ptr2argument)
+{
+    MamOS_mutexHandle LOC_ptr2mutex = a_ptr2argument;
+
     /* Check if the calling task is the owner of the mutex or not. */
-    if(a_ptr2mutex->ptr2ownerTask == G_kernelControlPanel.ptr2activeTask)
+    if(MAMOS_MUTEX_OWNER(LOC_ptr2mutex) == G_kernelControlPanel.ptr2activeTask)
     {
-        /* Fetch the highest priority task in the mutex waiting queue and make it the owner. */
-        a_ptr2mutex->ptr2ownerTask = a_ptr2mutex->waitingQueue.ptr2headTask;
+        MamOS_taskControlBlockType* LOC_ptr2ownerTask = G_kernelControlPanel.ptr2activeTask;
 
-        if(a_ptr2mutex->ptr2ownerTask != NULL_PTR)
+        /* Only a mutex tracked by the kernel is linked to the held mutexes of the owner, So unlink it, Then drop the
+         * priority the owner inherited through it. */
+        if((LOC_ptr2mutex->lockWord & MAMOS_MUTEX_KERNEL_FLAG) == 0)
         {
-            MamOS_removeFromWaitingQueue(a_ptr2mutex, a_ptr2mutex->ptr2ownerTask);
-            MamOS_addToReadyQueue(a_ptr2mutex->ptr2ownerTask);
+            /* The mutex was locked in thread mode and has no waiting tasks. */
+        }
+
+        else if(LOC_ptr2ownerTask->ptr2heldMutexes == LOC_ptr2mutex)
+        {
+            LOC_ptr2ownerTask->ptr2heldMutexes = LOC_ptr2mutex->ptr2nextHeldMutex;
         }
 
         else
         {
-            /* If there is no tasks in the mutex waiting queue, Unlock the mutex. */
-            a_ptr2mutex->mutexState = MAMOS_MUTEX_UNLOCKED;
+            MamOS_mutexHandle LOC_ptr2prevMutex = LOC_ptr2ownerTask->ptr2heldMutexes;
+
+            while(LOC_ptr2prevMutex->ptr2nextHeldMutex != LOC_ptr2mutex)
+            {
+                LOC_ptr2prevMutex = LOC_ptr2prevMutex->ptr2nextHeldMutex;
+            }
+
+            LOC_ptr2prevMutex->ptr2nextHeldMutex = LOC_ptr2mutex->ptr2nextHeldMutex;
         }
+
+        MamOS_restoreOwnerPriority(LOC_ptr2ownerTask);
+
+        MamOS_handOverMutex(LOC_ptr2mutex);
+
+        /* The new owner or a task that preceded the inherited priority may now precede the releasing task. */
+        MamOS_yieldFromISR(TRUE);
     }
 
     else
     {
         /* Invalid Operation. */
     }
+
+    return 0;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_releaseTaskMutexes
+ * [Description]   : Releases the mutexes of a task being deleted, Each mutex it owns is handed over to its waiting
+ *                   tasks, And the owners of the mutex it waits for drop the priority they inherited from it
+ *                   [called inside a kernel call after the task is unlinked from its waiting queue].
+ * [Arguments]     : <a_ptr2task>       -> Pointer to the task being deleted.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_releaseTaskMutexes(MamOS_taskControlBlockType* a_ptr2task)
+{
+    MamOS_leaveBlockingMutex(a_ptr2task);
+
+    /* The mutexes locked in thread mode aren't linked to the held mutexes of the task, So all the mutexes are
+     * searched for the owned ones. */
+    for(uint8 iterator = 0; iterator < G_kernelControlPanel.mutexCounter; iterator++)
+    {
+        if(MAMOS_MUTEX_OWNER(&G_mutexHeap[iterator]) == a_ptr2task)
+        {
+            MamOS_handOverMutex(&G_mutexHeap[iterator]);
+        }
+    }
+
+    a_ptr2task->ptr2heldMutexes = NULL_PTR;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_leaveBlockingMutex
+ * [Description]   : Stops a task from waiting for its blocking mutex, The owners it lent its priority to drop the
+ *                   priority they inherited from it [called inside a kernel call after the task is unlinked from
+ *                   its waiting queue].
+ * [Arguments]     : <a_ptr2task>       -> Pointer to the task that stops waiting.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_leaveBlockingMutex(MamOS_taskControlBlockType* a_ptr2task)
+{
+    MamOS_mutexHandle LOC_ptr2mutex = a_ptr2task->ptr2blockingMutex;
+    uint8 LOC_chainLength = 0;
+
+    a_ptr2task->ptr2blockingMutex = NULL_PTR;
+
+    /* Walk the chain of owners that the task lent its priority to, Each of them recalculates its priority. A chain
+     * of deadlocked tasks loops back, So the walk stops at the task itself and never visits more than all tasks. */
+    while((LOC_ptr2mutex != NULL_PTR) && (MAMOS_MUTEX_OWNER(LOC_ptr2mutex) != a_ptr2task) && (LOC_chainLength < MAMOS_TOTAL_NUM_OF_TASKS))
+    {
+        MamOS_taskControlBlockType* LOC_ptr2ownerTask = MAMOS_MUTEX_OWNER(LOC_ptr2mutex);
+
+        MamOS_restoreOwnerPriority(LOC_ptr2ownerTask);
+        LOC_ptr2mutex = (LOC_ptr2ownerTask->state == MAMOS_WAITING_TASK) ? LOC_ptr2ownerTask->ptr2blockingMutex : NULL_PTR;
+        LOC_chainLength++;
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_handOverMutex
+ * [Description]   : Hands a specific mutex over to the highest priority task waiting for it, Or unlocks it if no
+ *                   task waits for it [called inside a kernel call].
+ * [Arguments]     : <a_ptr2mutex>      -> Pointer to the required mutex.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_handOverMutex(MamOS_mutexHandle a_ptr2mutex)
+{
+    MamOS_taskControlBlockType* LOC_ptr2newOwnerTask = a_ptr2mutex->waitingQueue.ptr2headTask;
+
+    /* Fetch the highest priority task in the mutex waiting queue and make it the owner [tracked by the kernel]. */
+    if(LOC_ptr2newOwnerTask != NULL_PTR)
+    {
+        a_ptr2mutex->lockWord = (uint32)LOC_ptr2newOwnerTask | MAMOS_MUTEX_KERNEL_FLAG;
+        MamOS_wakeFromWaitingQueue(LOC_ptr2newOwnerTask);
+        LOC_ptr2newOwnerTask->ptr2blockingMutex = NULL_PTR;
+        a_ptr2mutex->ptr2nextHeldMutex = LOC_ptr2newOwnerTask->ptr2heldMutexes;
+        LOC_ptr2newOwnerTask->ptr2heldMutexes = a_ptr2mutex;
+
+        if(a_ptr2mutex->ceilingPriority < LOC_ptr2newOwnerTask->priority)
+        {
+            MamOS_changeTaskPriority(LOC_ptr2newOwnerTask, a_ptr2mutex->ceilingPriority);
+        }
+    }
+
+    else
+    {
+        /* If there is no tasks in the mutex waiting queue, Unlock the mutex. */
+        a_ptr2mutex->lockWord = MAMOS_MUTEX_UNLOCKED;
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_inheritMutexPriority
+ * [Description]   : Raises the priority of the owner of a specific mutex to the priority of a waiting task, Then
+ *                   the owners of the mutexes that each boosted owner waits for [transitive inheritance].
+ * [Arguments]     : <a_ptr2mutex>      -> Pointer to the mutex that the task waits for.
+ *                   <a_priority>       -> Indicates to the priority of the waiting task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_inheritMutexPriority(MamOS_mutexHandle a_ptr2mutex, uint8 a_priority)
+{
+    MamOS_mutexHandle LOC_ptr2mutex = a_ptr2mutex;
+
+    /* Walk the chain of owners until an owner already runs at the inherited priority [or a higher one]. */
+    while((LOC_ptr2mutex != NULL_PTR) && (a_priority < MAMOS_MUTEX_OWNER(LOC_ptr2mutex)->priority))
+    {
+        MamOS_taskControlBlockType* LOC_ptr2ownerTask = MAMOS_MUTEX_OWNER(LOC_ptr2mutex);
+
+        MamOS_changeTaskPriority(LOC_ptr2ownerTask, a_priority);
+        LOC_ptr2mutex = (LOC_ptr2ownerTask->state == MAMOS_WAITING_TASK) ? LOC_ptr2ownerTask->ptr2blockingMutex : NULL_PTR;
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_restoreOwnerPriority
+ * [Description]   : Recalculates the priority of a specific task from its base priority, The ceiling of each
+ *                   mutex it still holds, and the highest priority task waiting for each of them.
+ * [Arguments]     : <a_ptr2ownerTask>  -> Pointer to the required task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_restoreOwnerPriority(MamOS_taskControlBlockType* a_ptr2ownerTask)
+{
+    uint8 LOC_priority = a_ptr2ownerTask->basePriority;
+
+    /* The waiting queues are priority ordered, So only the head of each one is checked. */
+    for(MamOS_mutexHandle LOC_ptr2mutex = a_ptr2ownerTask->ptr2heldMutexes; LOC_ptr2mutex != NULL_PTR; LOC_ptr2mutex = LOC_ptr2mutex->ptr2nextHeldMutex)
+    {
+        if(LOC_ptr2mutex->ceilingPriority < LOC_priority)
+        {
+            LOC_priority = LOC_ptr2mutex->ceilingPriority;
+        }
+
+        if((LOC_ptr2mutex->waitingQueue.ptr2headTask != NULL_PTR) && (LOC_ptr2mutex->waitingQueue.ptr2headTask->priority < LOC_priority))
+        {
+            LOC_priority = LOC_ptr2mutex->waitingQueue.ptr2headTask->priority;
+        }
+    }
+
+    if(LOC_priority != a_ptr2ownerTask->priority)
+    {
+        MamOS_changeTaskPriority(a_ptr2ownerTask, LOC_priority);
+    }
 }
@@ -23,6 +23,7 @@ Description  : Private definitions for the MamOS kernel.
 
 #include "std_types.h"
 #include "../MamOSConfig.h"
+#include "../MamOS.h"
 
 /*=====================================================================================================================
                                 < Definitions and Static Configurations >
@@ -31,13 +32,78 @@ Description  : Private definitions for the MamOS kernel.
 #define MAMOS_IDLE_TASK_ID                    (0U)                    /* Reserved ID for the idle task.              */
 #define MAMOS_MIN_STACK_SIZE                  (20U)                   /* Minimum allowed stack size [in words].      */
 #define MAMOS_MAX_NUM_OF_MUTEX                (10U)                   /* Maximum number of mutex allowed the system. */
+#define MAMOS_MAX_NUM_OF_RING_BUFFERS         (4U)                    /* Maximum number of ring buffers allowed.     */
+#define MAMOS_MAX_NUM_OF_MESSAGE_QUEUES       (4U)                    /* Maximum number of message queues allowed.   */
+#define MAMOS_MAX_NUM_OF_SEMAPHORES           (10U)                   /* Maximum number of semaphores allowed.       */
+#define MAMOS_MAX_NUM_OF_EVENT_GROUPS         (4U)                    /* Maximum number of event groups allowed.     */
+#define MAMOS_MAX_NUM_OF_MEMORY_POOLS         (4U)                    /* Maximum number of memory pools allowed.     */
 #define MAMOS_TASK_TRANS_REQUEST_SVC          (0x00)                  /* SVC to request an immediate context switch. */
+#define MAMOS_TICKLESS_IDLE_REQUEST_SVC       (0x01)                  /* SVC to request a tickless idle period.      */
+#define MAMOS_TASK_RELEASE_REQUEST_SVC        (0x02)                  /* SVC to request blocking until release tick. */
+#define MAMOS_KERNEL_CALL_REQUEST_SVC         (0x03)                  /* SVC to run a kernel call in a critical sec. */
+#define MAMOS_INITIAL_EXC_RETURN              (0XFFFFFFFDUL)          /* Return to thread mode with PSP [no FPU].    */
+#define MAMOS_SOFTWARE_FRAME_SIZE             (9U)                    /* Words saved by PendSV [R4-R11, EXC_RETURN]. */
+#define MAMOS_NUM_OF_PRIORITIES               (256U)                  /* Number of task priority levels [0 ~ 255].   */
+#define MAMOS_PRIORITY_GROUP_SIZE             (32U)                   /* Number of priority levels in each group.    */
+#define MAMOS_MAX_DELAY_TICKS                 (0X7FFFFFFFUL)          /* Maximum wrap-safe delay [in ticks].         */
+#define MAMOS_WAIT_RESULT_PENDING             (2U)                    /* The task is blocked until the wait result.  */
+#define MAMOS_NOTIFICATION_NONE               (0U)                    /* No notification is pending or waited for.   */
+#define MAMOS_NOTIFICATION_WAITING            (1U)                    /* The task is blocked waiting a notification. */
+#define MAMOS_NOTIFICATION_PENDING            (2U)                    /* A notification is pending to be received.   */
+#define MAMOS_MUTEX_UNLOCKED                  (0UL)                   /* Lock word of a mutex that is available.     */
+#define MAMOS_MUTEX_KERNEL_FLAG               (1UL)                   /* Lock word flag: the release enters kernel.  */
+#define MAMOS_STACK_FILL_PATTERN              (0XA5A5A5A5UL)          /* Paint of the task stack words never used.   */
+#define MAMOS_MPU_GUARD_REGION                (2U)                    /* MPU region of the active task stack guard.  */
+#define MAMOS_MPU_NUM_OF_DATA_REGIONS         (2U)                    /* MPU data regions of each task.              */
+#define MAMOS_MPU_RBAR_VALID                  (0X10UL)                /* RBAR flag: it holds the region number.      */
+#define MAMOS_MPU_GUARD_RASR                  (0X11020009UL)          /* 32 bytes, Privileged RW only, No execution. */
+#define MAMOS_STACK_GUARD_SIZE                (8U)                    /* Words under a stack covered by its guard.   */
+
+/* Stack space needed by the FPU context of a task [S0-S15, FPSCR and a reserved word, Then S16-S31]. */
+#if defined(__ARM_FP)
+#define MAMOS_FPU_CONTEXT_SIZE                (34U)
+#else
+#define MAMOS_FPU_CONTEXT_SIZE                (0U)
+#endif
+
+/* Number of priority groups [words] in the ready queue priority bitmap. */
+#define MAMOS_NUM_OF_PRIORITY_GROUPS          (MAMOS_NUM_OF_PRIORITIES / MAMOS_PRIORITY_GROUP_SIZE)
 
 /* Total number of tasks in the system including idle task. */
 #define MAMOS_TOTAL_NUM_OF_TASKS              (MAMOS_MAX_NUM_OF_TASKS + 1)
 
-/* Total kernel stack size. */
-#define MAMOS_KERNEL_STACK_SIZE               ((MAMOS_MAX_NUM_OF_TASKS * MAMOS_MAX_STACK_SIZE) + MAMOS_MIN_STACK_SIZE)
+/* The blocked queue wheel slot is selected by masking the wake-up tick, so its size must be a power of two. */
+#if ((MAMOS_TIMER_WHEEL_SIZE == 0) || ((MAMOS_TIMER_WHEEL_SIZE & (MAMOS_TIMER_WHEEL_SIZE - 1)) != 0))
+#error "MAMOS_TIMER_WHEEL_SIZE must be a power of two."
+#endif
+
+/* A task must run for at least one tick before rotating to its equal priority peers. */
+#if ((MAMOS_TIME_SLICING == TRUE) && (MAMOS_TIME_SLICE_TICKS == 0))
+#error "MAMOS_TIME_SLICE_TICKS must be at least 1 tick."
+#endif
+
+/* A tickless idle period always ends on the tick that wakes up a task, So it has to cover more than one tick. */
+#if ((MAMOS_TICKLESS_IDLE == TRUE) && (MAMOS_TICKLESS_MIN_IDLE_TICKS < 2))
+#error "MAMOS_TICKLESS_MIN_IDLE_TICKS must be at least 2 ticks."
+#endif
+
+/* A zero BASEPRI value masks nothing, So the kernel critical sections need a non-zero priority ceiling. */
+#if (MAMOS_MAX_SYSCALL_PRIORITY == 0)
+#error "MAMOS_MAX_SYSCALL_PRIORITY must be a non-zero interrupt priority."
+#endif
+
+/* The heap holds a free block and its end marker at least, And the free lists cover the blocks below 128 KB. */
+#if ((MAMOS_HEAP_SIZE < 32) || (MAMOS_HEAP_SIZE >= 0X20000UL) || ((MAMOS_HEAP_SIZE % 8) != 0))
+#error "MAMOS_HEAP_SIZE must be a multiple of 8 bytes from 32 bytes up to below 128 KB."
+#endif
+
+/* Total kernel stack size [the stacks of the created tasks and the idle task stack, in double words]. */
+#if (MAMOS_MPU_PROTECTION == TRUE)
+/* The guard of the lowest task stack is kept inside the kernel stack too. */
+#define MAMOS_KERNEL_STACK_SIZE               (MAMOS_ALIGN_STACK_SIZE(MAMOS_STACK_POOL_SIZE) + MAMOS_ALIGN_STACK_SIZE(MAMOS_MIN_STACK_SIZE) + MAMOS_STACK_GUARD_SIZE)
+#else
+#define MAMOS_KERNEL_STACK_SIZE               (MAMOS_ALIGN_STACK_SIZE(MAMOS_STACK_POOL_SIZE) + MAMOS_MIN_STACK_SIZE)
+#endif
 
 /*=====================================================================================================================
                                        < User-defined Data Types >
@@ -50,63 +116,184 @@ typedef enum
     MAMOS_BLOCKED_TASK,                                                    /* Task is blocked on delay.              */
     MAMOS_WAITING_TASK,                                                    /* Task is waiting for a shared resource. */
     MAMOS_SUSPENDED_TASK,                                                  /* Task is suspended from scheduling.     */
+    MAMOS_DELETED_TASK,                                                    /* Task is deleted [its TCB is free].     */
 }MamOS_taskStateType;
 
-typedef enum
-{
-    MAMOS_MUTEX_UNLOCKED,                                                     /* Mutex is available for acquisition. */
-    MAMOS_MUTEX_LOCKED,                                                       /* Mutex is currently held by a task.  */
-}MamOS_mutexStateType;
-
 struct TaskControlBlock
 {
     uint8 id;                                                         /* Unique task identifier.                     */
     uint8 priority;                                                   /* Task scheduling priority.                   */
     uint16 periodicity;                                               /* Period for periodic tasks [in ticks].       */
-    uint16 delayTicks;                                                /* Period for blocked tasks [in ticks].        */
     uint16 stackSize;                                                 /* Size of the task stack [in words].          */
     uint32* stackPointer;                                             /* Current position of the task stack pointer. */
+    uint32 delayTicks;                                                /* Delay, Then wake-up tick of blocked tasks.  */
     MamOS_taskStateType state;                                        /* Current task state.                         */
     void (*ptr2entryPoint)(void);                                     /* Task main function entry point.             */
     struct TaskControlBlock* ptr2nextTask;                            /* Next TCB in the queue.                      */
+    struct TaskControlBlock* ptr2prevTask;                            /* Previous TCB in the ready/blocked queue.    */
+    uint32 deadline;                                                  /* Absolute deadline of the current job.       */
+    uint32 releaseTick;                                               /* Absolute release tick of the current job.   */
+    uint8 fpuUsage;                                                   /* Whether the task may use the FPU or not.    */
+    struct TaskControlBlock* ptr2nextWaitingTask;                     /* Next TCB in the waiting queue.              */
+    struct QueueType* ptr2waitingQueue;                               /* The waiting queue that holds the task.      */
+    void* ptr2waitingData;                                            /* Item exchanged with the waiting task.       */
+    uint8 timedWaitFlag;                                              /* The waiting task is in the blocked queue.   */
+    uint8 waitResult;                                                 /* TRUE if the wait succeeded [not timed out]. */
+    uint32 notificationValue;                                         /* The direct-to-task notification value.      */
+    uint8 notificationState;                                          /* Notification state [none/waiting/pending].  */
+    uint8 basePriority;                                               /* Assigned priority without inheritance.      */
+    struct mutex* ptr2blockingMutex;                                  /* The mutex that the task waits for [if any]. */
+    struct mutex* ptr2heldMutexes;                                    /* List of the mutexes held by the task.       */
+    uint32* ptr2stackBase;                                            /* Lowest address of the task stack.           */
+    uint32 mpuRegions[2U * (MAMOS_MPU_NUM_OF_DATA_REGIONS + 1U)];     /* MPU RBAR/RASR pairs [guard, Then data].     */
 };
 
 typedef struct TaskControlBlock MamOS_taskControlBlockType;
 
-typedef struct
+typedef struct TaskControlBlock* MamOS_taskHandle;
+
+typedef struct QueueType
 {
     uint8 queueSize;                                                          /* Current number of tasks in queue.   */
     MamOS_taskControlBlockType* ptr2headTask;                                 /* The first task in queue.            */
     MamOS_taskControlBlockType* ptr2rearTask;                                 /* The last task in queue.             */
 }MamOS_QueueType;
 
+typedef struct
+{
+    uint32 priorityGroups;                                  /* Bitmap of the priority groups that have ready tasks.  */
+    uint32 priorityBitmap[MAMOS_NUM_OF_PRIORITY_GROUPS];    /* Bitmap of the priority levels that have ready tasks.  */
+    MamOS_QueueType priorityLists[MAMOS_NUM_OF_PRIORITIES]; /* FIFO list of the ready tasks for each priority level. */
+#if (MAMOS_SCHEDULING_POLICY == MAMOS_EDF_POLICY)
+    MamOS_QueueType deadlineList;                           /* List of the ready periodic tasks ordered by deadline. */
+#endif
+}MamOS_readyQueueType;
+
+typedef struct
+{
+    uint8 queueSize;                                        /* Current number of tasks in all the wheel slots.       */
+    MamOS_QueueType wheelSlots[MAMOS_TIMER_WHEEL_SIZE];     /* Unordered list of the tasks that wake up in each slot. */
+}MamOS_blockedQueueType;
+
 typedef struct mutex
 {
-    MamOS_taskControlBlockType* ptr2ownerTask;              /* The task that currently holding the mutex.            */
-    MamOS_mutexStateType mutexState;                        /* Current mutex state.                                  */
+    volatile uint32 lockWord;                               /* The owner task address [or unlocked] and kernel flag. */
     MamOS_QueueType waitingQueue;                           /* Queue of tasks that waiting for the mutex.            */
+    struct mutex* ptr2nextHeldMutex;                        /* Next mutex held by the same owner task.               */
+    uint8 ceilingPriority;                                  /* Priority of the owner while holding the mutex.        */
 }MamOS_mutexType;
 
 typedef struct mutex* MamOS_mutexHandle;
 
+typedef struct ringBuffer
+{
+    volatile uint32 writeIndex;                             /* Free-running write index [modified by producer only]. */
+    volatile uint32 readIndex;                              /* Free-running read index [modified by consumer only].  */
+    uint32 indexMask;                                       /* Capacity minus one [the capacity is a power of two].  */
+    uint8* ptr2storage;                                     /* The storage buffer supplied by the user.              */
+    MamOS_taskControlBlockType* volatile ptr2waitingTask;   /* The consumer task that waits for data [if any].       */
+}MamOS_ringBufferType;
+
+typedef struct ringBuffer* MamOS_ringBufferHandle;
+
+typedef struct messageQueue
+{
+    uint8* ptr2storage;                                     /* The storage buffer supplied by the user.              */
+    uint16 itemSize;                                        /* Size of a single item [in bytes].                     */
+    uint16 capacity;                                        /* Maximum number of items in the storage buffer.        */
+    uint16 itemsCount;                                      /* Current number of items in the storage buffer.        */
+    uint16 readSlot;                                        /* Slot of the oldest item in the storage buffer.        */
+    uint16 writeSlot;                                       /* Slot of the next item to be stored.                   */
+    MamOS_QueueType sendersQueue;                           /* Queue of tasks that waiting for a free slot.          */
+    MamOS_QueueType receiversQueue;                         /* Queue of tasks that waiting for an item.              */
+}MamOS_messageQueueType;
+
+typedef struct messageQueue* MamOS_messageQueueHandle;
+
+typedef struct semaphore
+{
+    uint32 count;                                           /* Current number of available tokens.                   */
+    uint32 maxCount;                                        /* Maximum number of tokens [one for binary semaphores]. */
+    MamOS_QueueType waitingQueue;                           /* Queue of tasks that waiting for a token.              */
+}MamOS_semaphoreType;
+
+typedef struct semaphore* MamOS_semaphoreHandle;
+
+typedef struct eventGroup
+{
+    volatile uint32 eventBits;                              /* Current value of the event bits.                      */
+    uint32 deferredBits;                                    /* Bits set from interrupts and not yet processed.       */
+    MamOS_QueueType waitingQueue;                           /* Queue of tasks that waiting for event bits.           */
+}MamOS_eventGroupType;
+
+typedef struct eventGroup* MamOS_eventGroupHandle;
+
+typedef struct memoryPool
+{
+    void* ptr2freeBlocks;                                   /* List of the free blocks [linked through the blocks].  */
+    uint32 blockSize;                                       /* Size of a single block [in bytes, word aligned].      */
+    uint32 numOfBlocks;                                     /* Total number of blocks in the memory pool.            */
+    uint32 usedBlocks;                                      /* Current number of allocated blocks.                   */
+    uint32 maxUsedBlocks;                                   /* Highest number of blocks allocated at the same time.  */
+    MamOS_QueueType waitingQueue;                           /* Queue of tasks that waiting for a free block.         */
+}MamOS_memoryPoolType;
+
+typedef struct memoryPool* MamOS_memoryPoolHandle;
+
+/* A kernel function that runs in handler mode inside a critical section on behalf of the calling task. */
+typedef uint32 (*MamOS_kernelCallType)(void* a_ptr2argument);
+
 typedef struct
 {
-    uint8 taskCounter;                                              /* Current number of tasks in the system.        */
+    uint8 taskCounter;                                              /* Number of task control blocks ever used.      */
     uint32* kernelStackPointer;                                     /* Current position of the kernel stack pointer. */
     MamOS_taskControlBlockType* ptr2activeTask;                     /* The currently executing task.                 */
     MamOS_taskControlBlockType* ptr2standbyTask;                    /* The next task selected to run.                */
-    MamOS_QueueType blockedQueue;                                   /* Queue of the blocked tasks.                   */
-    MamOS_QueueType readyQueue;                                     /* Queue of the ready tasks.                     */
+    MamOS_blockedQueueType blockedQueue;                            /* Queue of the blocked tasks.                   */
+    MamOS_readyQueueType readyQueue;                                /* Queue of the ready tasks.                     */
     uint8 blockEmptyFlag;                                           /* Flag indicates if blocked queue is empty.     */
     uint64 ticksCounter;                                            /* System tick counter.                          */
+    uint32 checkedTick;                                             /* Last tick whose wheel slot was visited.       */
     uint8 mutexCounter;                                             /* Current number of created mutex.              */
+    uint8 ringBufferCounter;                                        /* Current number of created ring buffers.       */
+    uint8 messageQueueCounter;                                      /* Current number of created message queues.     */
+    uint8 semaphoreCounter;                                         /* Current number of created semaphores.         */
+    uint8 eventGroupCounter;                                        /* Current number of created event groups.       */
+    uint8 deferredEventsFlag;                                       /* Event bits set from interrupts are pending.   */
+    uint8 memoryPoolCounter;                                        /* Current number of created memory pools.       */
+    uint16 sliceTicksCounter;                                       /* Ticks consumed from the active task slice.    */
+    uint8 criticalNesting;                                          /* Nesting depth of the kernel critical section. */
+    uint8 savedBasePriority;                                        /* BASEPRI value before the outermost critical.  */
 }MamOS_kernelControlPanelType;
 
 /*=====================================================================================================================
                                          < Function-like Macros >
 =====================================================================================================================*/
 
+/* Checks if a specific absolute tick has been reached at the current tick [wrap-safe for the 32-bit ticks]. */
+#define MAMOS_TICK_IS_REACHED(TICK, CURRENT_TICK)               ((sint32)((uint32)(CURRENT_TICK) - (uint32)(TICK)) >= 0)
+
+#if (MAMOS_MPU_PROTECTION == TRUE)
+/* Rounds a stack size up to a whole number of 32-byte blocks [each stack base is aligned for its MPU guard]. */
+#define MAMOS_ALIGN_STACK_SIZE(SIZE)          (((SIZE) + 7U) & ~7U)
+#else
+/* Rounds a stack size up to a whole number of double words [the stack tops are 8-byte aligned]. */
+#define MAMOS_ALIGN_STACK_SIZE(SIZE)          (((SIZE) + 1U) & ~1U)
+#endif
+
+/* Rounds a memory pool block size up to a whole number of words [a free block holds the next free block address]. */
+#define MAMOS_ALIGN_BLOCK_SIZE(SIZE)          (((SIZE) + 3U) & ~3U)
+
+/* Macro to make sure all the memory accesses before it complete before any memory access after it. */
+#define MAMOS_MEMORY_BARRIER()                __asm__ volatile ("DMB" ::: "memory")
+
 /* Macro to generate an SVC instruction to request an immediate task context switch. */
 #define MAMOS_TASK_TRANS_REQUEST()            __asm__ volatile ("SVC %[immediate]" :: [immediate] "I" (MAMOS_TASK_TRANS_REQUEST_SVC));
 
+/* Macro to generate an SVC instruction to request blocking the current task until its absolute release tick. */
+#define MAMOS_TASK_RELEASE_REQUEST()          __asm__ volatile ("SVC %[immediate]" :: [immediate] "I" (MAMOS_TASK_RELEASE_REQUEST_SVC));
+
+/* Macro to generate an SVC instruction to request a tickless idle period [the idle task runs unprivileged]. */
+#define MAMOS_TICKLESS_IDLE_REQUEST()         __asm__ volatile ("SVC %[immediate]" :: [immediate] "I" (MAMOS_TICKLESS_IDLE_REQUEST_SVC));
+
 #endif /* MAMOS_OTHERS_KERNEL_DEFS_H_ */
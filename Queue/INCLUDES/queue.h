@@ -16,6 +16,33 @@ Description  : Interface file for the MamOS Queue moduler.
                                          < Functions Prototypes >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_initReadyQueue
+ * [Description]   : Initializes the ready queue to be empty [all priority lists and bitmaps are cleared].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_initReadyQueue(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHighestReadyTask
+ * [Description]   : Gets the earliest deadline ready periodic task [EDF policy], Otherwise the first task in the
+ *                   highest priority non-empty list of the ready queue.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns pointer to the highest priority ready task [or Null Pointer if empty, As
+ *                   the idle task leaves the ready queue while it's selected to run].
+ ====================================================================================================================*/
+MamOS_taskControlBlockType* MamOS_getHighestReadyTask(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_isTaskPreceding
+ * [Description]   : Checks if a specific task should run before another one according to the scheduling policy.
+ * [Arguments]     : <a_ptr2firstTask>           -> Pointer to the first task.
+ *                   <a_ptr2secondTask>          -> Pointer to the second task.
+ * [return]        : The function returns TRUE if the first task precedes the second one, FALSE otherwise.
+ ====================================================================================================================*/
+uint8 MamOS_isTaskPreceding(MamOS_taskControlBlockType* a_ptr2firstTask, MamOS_taskControlBlockType* a_ptr2secondTask);
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_addToReadyQueue
  * [Description]   : Adds a specific task to the ready queue and change its state.
@@ -32,6 +59,30 @@ void MamOS_addToReadyQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock);
  ====================================================================================================================*/
 void MamOS_removeFromReadyQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_initBlockedQueue
+ * [Description]   : Initializes the blocked queue to be empty [all the wheel slots are cleared].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_initBlockedQueue(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getBlockedQueueSlot
+ * [Description]   : Gets the first task in the blocked queue wheel slot of a specific tick.
+ * [Arguments]     : <a_tick>                    -> Indicates to the required system tick.
+ * [return]        : The function returns pointer to the first task in the slot [or Null Pointer if empty].
+ ====================================================================================================================*/
+MamOS_taskControlBlockType* MamOS_getBlockedQueueSlot(uint32 a_tick);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getNearestWakeUpDelay
+ * [Description]   : Gets the number of ticks until the nearest wake-up in the blocked queue.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the number of ticks until the nearest wake-up [or zero if empty].
+ ====================================================================================================================*/
+uint32 MamOS_getNearestWakeUpDelay(void);
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_addToBlockedQueue
  * [Description]   : Adds a specific task to the blocked queue and change its state.
@@ -50,20 +101,51 @@ void MamOS_removeFromBlockedQueue(MamOS_taskControlBlockType* a_ptr2taskControlB
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_addToWaitingQueue
- * [Description]   : Adds a specific task to the waiting queue of a specific mutex and change its state.
- * [Arguments]     : <a_ptr2mutex>            -> Pointer to the mutex.
+ * [Description]   : Adds a specific task to a specific waiting queue ordered by priority and change its state,
+ *                   The task is also added to the blocked queue to wake it up if the wait times out.
+ * [Arguments]     : <a_ptr2waitingQueue>     -> Pointer to the waiting queue [of a mutex, a message queue, etc],
+ *                                               Or Null Pointer if the task waits for a direct notification.
  *                   <a_ptr2taskControlBlock> -> Pointer to the task to be added to the waiting queue.
+ *                   <a_timeoutTicks>         -> Indicates to the maximum waiting time [in ticks, non-zero], Or
+ *                                               MAMOS_WAIT_FOREVER to wait without a timeout.
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_addToWaitingQueue(MamOS_mutexHandle a_ptr2mutex, MamOS_taskControlBlockType* a_ptr2taskControlBlock);
+void MamOS_addToWaitingQueue(MamOS_QueueType* a_ptr2waitingQueue, MamOS_taskControlBlockType* a_ptr2taskControlBlock, uint32 a_timeoutTicks);
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_removeFromWaitingQueue
- * [Description]   : Removes a specific task from the waiting queue of a specific mutex.
- * [Arguments]     : <a_ptr2mutex>            -> Pointer to the mutex.
- *                   <a_ptr2taskControlBlock> -> Pointer to the task to be removed from the waiting queue.
+ * [Description]   : Removes a specific task from the waiting queue that holds it.
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the task to be removed from the waiting queue.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_removeFromWaitingQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_wakeFromWaitingQueue
+ * [Description]   : Wakes a specific waiting task up after its wait is satisfied, Removing it from its waiting
+ *                   queue [and from the blocked queue if its wait is timed], Then adding it to the ready queue.
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the task to be woken up.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_wakeFromWaitingQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_cancelWait
+ * [Description]   : Cancels the wait of a specific task without satisfying it, Removing it from its waiting queue
+ *                   [and from the blocked queue if its wait is timed], So its wait result stays FALSE.
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the waiting task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_cancelWait(MamOS_taskControlBlockType* a_ptr2taskControlBlock);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_changeTaskPriority
+ * [Description]   : Changes the priority of a specific task, Repositioning it in the ready queue or in its waiting
+ *                   queue [if it's linked in any of them].
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the required task.
+ *                   <a_priority>             -> Indicates to the new task priority [0 ~ 255].
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_removeFromWaitingQueue(MamOS_mutexHandle a_ptr2mutex, MamOS_taskControlBlockType* a_ptr2taskControlBlock);
+void MamOS_changeTaskPriority(MamOS_taskControlBlockType* a_ptr2taskControlBlock, uint8 a_priority);
 
 #endif /* MAMOS_QUEUE_INCLUDES_QUEUE_H_ */
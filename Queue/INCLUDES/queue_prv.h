@@ -24,7 +24,7 @@ Description  : Private file for the MamOS Queue moduler.
 =====================================================================================================================*/
 
 /* Extracts the delay value from a specific task control block. */
-#define MAMOS_GET_DELAY(TASK)                                                  ((*((uint32*)TASK + 1) & 0x0000FFFF))
+#define MAMOS_GET_DELAY(TASK)                                                                   ((TASK)->delayTicks)
 
 /* Extracts the priority value from a specific task control block. */
 #define MAMOS_GET_PRIORITY(TASK)                                              ((*((uint32*)TASK) & 0x0000FF00) >> 8)
@@ -32,10 +32,35 @@ Description  : Private file for the MamOS Queue moduler.
 /* Gets either priority or delay value based on comparator type. */
 #define MAMOS_GET_COMPARATOR_VALUE(TASK, COMPARATOR) (COMPARATOR ? MAMOS_GET_DELAY(TASK) : MAMOS_GET_PRIORITY(TASK))
 
+/* Gets the index of the priority group that holds a specific priority level. */
+#define MAMOS_GET_PRIORITY_GROUP(PRIORITY)                                    ((PRIORITY) / MAMOS_PRIORITY_GROUP_SIZE)
+
+/* Gets the bitmap mask of a specific priority level [the highest priority is mapped to the MSB]. */
+#define MAMOS_GET_PRIORITY_MASK(PRIORITY)                     (0X80000000UL >> ((PRIORITY) % MAMOS_PRIORITY_GROUP_SIZE))
+
+/* Gets the blocked queue wheel slot of a specific wake-up tick. */
+#define MAMOS_GET_WHEEL_SLOT(TICK)                                          ((TICK) & (MAMOS_TIMER_WHEEL_SIZE - 1))
+
+/* Checks if a specific absolute deadline comes before another one [wrap-safe]. */
+#define MAMOS_DEADLINE_IS_BEFORE(DEADLINE1, DEADLINE2)                  ((sint32)((DEADLINE1) - (DEADLINE2)) < 0)
+
+/* Counts the leading zeros of a non-zero bitmap word [compiles to a single CLZ instruction on ARMv7-M]. */
+#define MAMOS_COUNT_LEADING_ZEROS(WORD)                                           ((uint8)__builtin_clz((uint32)(WORD)))
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_addToDeadlineList
+ * [Description]   : Adds a specific periodic task to the ready queue deadline list ordered by its absolute deadline.
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the task to be added to the deadline list.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+#if (MAMOS_SCHEDULING_POLICY == MAMOS_EDF_POLICY)
+static void MamOS_addToDeadlineList(MamOS_taskControlBlockType* a_ptr2taskControlBlock);
+#endif
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_addToQueue
  * [Description]   : Adds a specific task to a specific queue.
@@ -11,6 +11,10 @@ Description  : Source file for the MamOS Queue moduler.
 
 /*=====================================================================================================================
  * [Details]     : This module manages all the queues in MamOS [Ready, Blocked, and Waiting].
+ *                 The ready queue is a FIFO list per priority level indexed by a two-level priority bitmap,
+ *                 so adding, removing, and fetching the highest priority task are constant time operations.
+ *                 The blocked queue is a timing wheel of unordered slots indexed by the wake-up tick,
+ *                 so the system tick only visits the tasks that share the slot of the current tick.
  ====================================================================================================================*/
 
 /*=====================================================================================================================
@@ -33,6 +37,103 @@ extern MamOS_kernelControlPanelType G_kernelControlPanel;
                                           < Functions Definitions >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_initReadyQueue
+ * [Description]   : Initializes the ready queue to be empty [all priority lists and bitmaps are cleared].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_initReadyQueue(void)
+{
+    G_kernelControlPanel.readyQueue.priorityGroups = 0;
+
+    for(uint8 iterator = 0; iterator < MAMOS_NUM_OF_PRIORITY_GROUPS; iterator++)
+    {
+        G_kernelControlPanel.readyQueue.priorityBitmap[iterator] = 0;
+    }
+
+    for(uint16 iterator = 0; iterator < MAMOS_NUM_OF_PRIORITIES; iterator++)
+    {
+        G_kernelControlPanel.readyQueue.priorityLists[iterator].ptr2headTask = NULL_PTR;
+        G_kernelControlPanel.readyQueue.priorityLists[iterator].ptr2rearTask = NULL_PTR;
+    }
+
+    #if (MAMOS_SCHEDULING_POLICY == MAMOS_EDF_POLICY)
+    G_kernelControlPanel.readyQueue.deadlineList.ptr2headTask = NULL_PTR;
+    G_kernelControlPanel.readyQueue.deadlineList.ptr2rearTask = NULL_PTR;
+    #endif
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getHighestReadyTask
+ * [Description]   : Gets the earliest deadline ready periodic task [EDF policy], Otherwise the first task in the
+ *                   highest priority non-empty list of the ready queue.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns pointer to the highest priority ready task [or Null Pointer if empty, As
+ *                   the idle task leaves the ready queue while it's selected to run].
+ ====================================================================================================================*/
+MamOS_taskControlBlockType* MamOS_getHighestReadyTask(void)
+{
+    MamOS_taskControlBlockType* LOC_ptr2highestTask = NULL_PTR;
+
+    #if (MAMOS_SCHEDULING_POLICY == MAMOS_EDF_POLICY)
+    /* The ready periodic tasks run before the aperiodic ones, The earliest deadline is always at the head. */
+    if(G_kernelControlPanel.readyQueue.deadlineList.ptr2headTask != NULL_PTR)
+    {
+        LOC_ptr2highestTask = G_kernelControlPanel.readyQueue.deadlineList.ptr2headTask;
+    }
+
+    else if(G_kernelControlPanel.readyQueue.priorityGroups != 0)
+    #else
+    if(G_kernelControlPanel.readyQueue.priorityGroups != 0)
+    #endif
+    {
+        /* Resolve the highest priority group, then the highest priority level inside it [two CLZ operations]. */
+        uint8 LOC_priorityGroup = MAMOS_COUNT_LEADING_ZEROS(G_kernelControlPanel.readyQueue.priorityGroups);
+        uint8 LOC_priorityLevel = MAMOS_COUNT_LEADING_ZEROS(G_kernelControlPanel.readyQueue.priorityBitmap[LOC_priorityGroup]);
+        uint8 LOC_priority = (LOC_priorityGroup * MAMOS_PRIORITY_GROUP_SIZE) + LOC_priorityLevel;
+
+        LOC_ptr2highestTask = G_kernelControlPanel.readyQueue.priorityLists[LOC_priority].ptr2headTask;
+    }
+
+    return LOC_ptr2highestTask;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_isTaskPreceding
+ * [Description]   : Checks if a specific task should run before another one according to the scheduling policy.
+ * [Arguments]     : <a_ptr2firstTask>           -> Pointer to the first task.
+ *                   <a_ptr2secondTask>          -> Pointer to the second task.
+ * [return]        : The function returns TRUE if the first task precedes the second one, FALSE otherwise.
+ ====================================================================================================================*/
+uint8 MamOS_isTaskPreceding(MamOS_taskControlBlockType* a_ptr2firstTask, MamOS_taskControlBlockType* a_ptr2secondTask)
+{
+    uint8 LOC_precedingFlag = FALSE;
+
+    #if (MAMOS_SCHEDULING_POLICY == MAMOS_EDF_POLICY)
+    /* Periodic tasks are compared by their deadlines and precede the aperiodic tasks. */
+    if((a_ptr2firstTask->periodicity != 0) && (a_ptr2secondTask->periodicity != 0))
+    {
+        LOC_precedingFlag = MAMOS_DEADLINE_IS_BEFORE(a_ptr2firstTask->deadline, a_ptr2secondTask->deadline);
+    }
+
+    else if((a_ptr2firstTask->periodicity != 0) || (a_ptr2secondTask->periodicity != 0))
+    {
+        LOC_precedingFlag = (a_ptr2firstTask->periodicity != 0);
+    }
+
+    else
+    {
+        /* Aperiodic tasks fall back to their priorities. */
+        LOC_precedingFlag = (a_ptr2firstTask->priority < a_ptr2secondTask->priority);
+    }
+    #else
+    LOC_precedingFlag = (a_ptr2firstTask->priority < a_ptr2secondTask->priority);
+    #endif
+
+    return LOC_precedingFlag;
+}
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_addToReadyQueue
  * [Description]   : Adds a specific task to the ready queue and change its state.
@@ -42,7 +143,40 @@ extern MamOS_kernelControlPanelType G_kernelControlPanel;
 void MamOS_addToReadyQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
 {
     a_ptr2taskControlBlock->state = MAMOS_READY_TASK;
-    MamOS_addToQueue(&G_kernelControlPanel.readyQueue, MAMOS_PRIORITY_COMPARATOR_ID, a_ptr2taskControlBlock);
+
+    #if (MAMOS_SCHEDULING_POLICY == MAMOS_EDF_POLICY)
+    /* Periodic tasks are ordered by their deadlines instead of their priorities. */
+    if(a_ptr2taskControlBlock->periodicity != 0)
+    {
+        MamOS_addToDeadlineList(a_ptr2taskControlBlock);
+    }
+
+    else
+    #endif
+    {
+        uint8 LOC_priority = a_ptr2taskControlBlock->priority;
+        MamOS_QueueType* LOC_ptr2priorityList = &G_kernelControlPanel.readyQueue.priorityLists[LOC_priority];
+
+        /* Append the task at the rear of its priority list to keep FIFO order among equal priorities. */
+        a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
+        a_ptr2taskControlBlock->ptr2prevTask = LOC_ptr2priorityList->ptr2rearTask;
+
+        if(LOC_ptr2priorityList->ptr2headTask == NULL_PTR)
+        {
+            LOC_ptr2priorityList->ptr2headTask = a_ptr2taskControlBlock;
+
+            /* The priority list was empty, Mark its priority level and group as ready. */
+            G_kernelControlPanel.readyQueue.priorityBitmap[MAMOS_GET_PRIORITY_GROUP(LOC_priority)] |= MAMOS_GET_PRIORITY_MASK(LOC_priority);
+            G_kernelControlPanel.readyQueue.priorityGroups |= MAMOS_GET_PRIORITY_MASK(MAMOS_GET_PRIORITY_GROUP(LOC_priority));
+        }
+
+        else
+        {
+            LOC_ptr2priorityList->ptr2rearTask->ptr2nextTask = a_ptr2taskControlBlock;
+        }
+
+        LOC_ptr2priorityList->ptr2rearTask = a_ptr2taskControlBlock;
+    }
 }
 
 /*=====================================================================================================================
@@ -53,15 +187,110 @@ void MamOS_addToReadyQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
  ====================================================================================================================*/
 void MamOS_removeFromReadyQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
 {
-    if(a_ptr2taskControlBlock->id == MAMOS_IDLE_TASK_ID)
+    if(a_ptr2taskControlBlock->state != MAMOS_READY_TASK)
     {
-        /* Invalid Operation [system idle task can not be removed from the ready queue]. */
+        /* Invalid Operation [the task is not linked in the ready queue]. */
     }
     
     else
     {
-        MamOS_removeFromQueue(&G_kernelControlPanel.readyQueue, a_ptr2taskControlBlock);
+        uint8 LOC_priority = a_ptr2taskControlBlock->priority;
+        MamOS_QueueType* LOC_ptr2priorityList = &G_kernelControlPanel.readyQueue.priorityLists[LOC_priority];
+
+        #if (MAMOS_SCHEDULING_POLICY == MAMOS_EDF_POLICY)
+        /* Periodic tasks are linked in the deadline list instead of their priority lists. */
+        if(a_ptr2taskControlBlock->periodicity != 0)
+        {
+            LOC_ptr2priorityList = &G_kernelControlPanel.readyQueue.deadlineList;
+        }
+        #endif
+
+        /* Unlink the task from its list [no search is needed as the list is doubly linked]. */
+        if(a_ptr2taskControlBlock->ptr2prevTask == NULL_PTR) LOC_ptr2priorityList->ptr2headTask = a_ptr2taskControlBlock->ptr2nextTask;
+        else a_ptr2taskControlBlock->ptr2prevTask->ptr2nextTask = a_ptr2taskControlBlock->ptr2nextTask;
+
+        if(a_ptr2taskControlBlock->ptr2nextTask == NULL_PTR) LOC_ptr2priorityList->ptr2rearTask = a_ptr2taskControlBlock->ptr2prevTask;
+        else a_ptr2taskControlBlock->ptr2nextTask->ptr2prevTask = a_ptr2taskControlBlock->ptr2prevTask;
+
+        a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
+        a_ptr2taskControlBlock->ptr2prevTask = NULL_PTR;
+
+        /* If the priority list became empty, Clear its priority level [and its group if it has no more levels]. */
+        if((LOC_ptr2priorityList->ptr2headTask == NULL_PTR) && (LOC_ptr2priorityList == &G_kernelControlPanel.readyQueue.priorityLists[LOC_priority]))
+        {
+            G_kernelControlPanel.readyQueue.priorityBitmap[MAMOS_GET_PRIORITY_GROUP(LOC_priority)] &= ~MAMOS_GET_PRIORITY_MASK(LOC_priority);
+
+            if(G_kernelControlPanel.readyQueue.priorityBitmap[MAMOS_GET_PRIORITY_GROUP(LOC_priority)] == 0)
+            {
+                G_kernelControlPanel.readyQueue.priorityGroups &= ~MAMOS_GET_PRIORITY_MASK(MAMOS_GET_PRIORITY_GROUP(LOC_priority));
+            }
+        }
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_initBlockedQueue
+ * [Description]   : Initializes the blocked queue to be empty [all the wheel slots are cleared].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_initBlockedQueue(void)
+{
+    G_kernelControlPanel.blockedQueue.queueSize = 0;
+
+    for(uint16 iterator = 0; iterator < MAMOS_TIMER_WHEEL_SIZE; iterator++)
+    {
+        G_kernelControlPanel.blockedQueue.wheelSlots[iterator].ptr2headTask = NULL_PTR;
+        G_kernelControlPanel.blockedQueue.wheelSlots[iterator].ptr2rearTask = NULL_PTR;
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getBlockedQueueSlot
+ * [Description]   : Gets the first task in the blocked queue wheel slot of a specific tick.
+ * [Arguments]     : <a_tick>                    -> Indicates to the required system tick.
+ * [return]        : The function returns pointer to the first task in the slot [or Null Pointer if empty].
+ ====================================================================================================================*/
+MamOS_taskControlBlockType* MamOS_getBlockedQueueSlot(uint32 a_tick)
+{
+    return G_kernelControlPanel.blockedQueue.wheelSlots[MAMOS_GET_WHEEL_SLOT(a_tick)].ptr2headTask;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getNearestWakeUpDelay
+ * [Description]   : Gets the number of ticks until the nearest wake-up in the blocked queue.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the number of ticks until the nearest wake-up [or zero if empty].
+ ====================================================================================================================*/
+uint32 MamOS_getNearestWakeUpDelay(void)
+{
+    uint32 LOC_nearestDelay = 0;
+
+    /* The wheel slots are unordered, So all the blocked tasks are visited [only called from the idle path]. */
+    for(uint16 iterator = 0; iterator < MAMOS_TIMER_WHEEL_SIZE; iterator++)
+    {
+        MamOS_taskControlBlockType* LOC_ptr2currentTask = G_kernelControlPanel.blockedQueue.wheelSlots[iterator].ptr2headTask;
+
+        while(LOC_ptr2currentTask != NULL_PTR)
+        {
+            uint32 LOC_remainingDelay = LOC_ptr2currentTask->delayTicks - (uint32)G_kernelControlPanel.ticksCounter;
+
+            /* A wake-up tick that has already been reached is due at the next tick. */
+            if(MAMOS_TICK_IS_REACHED(LOC_ptr2currentTask->delayTicks, G_kernelControlPanel.ticksCounter))
+            {
+                LOC_remainingDelay = 1;
+            }
+
+            if((LOC_nearestDelay == 0) || (LOC_remainingDelay < LOC_nearestDelay))
+            {
+                LOC_nearestDelay = LOC_remainingDelay;
+            }
+
+            LOC_ptr2currentTask = LOC_ptr2currentTask->ptr2nextTask;
+        }
     }
+
+    return LOC_nearestDelay;
 }
 
 /*=====================================================================================================================
@@ -72,10 +301,33 @@ void MamOS_removeFromReadyQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlo
  ====================================================================================================================*/
 void MamOS_addToBlockedQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
 {
-    G_kernelControlPanel.blockEmptyFlag = FALSE;
-    a_ptr2taskControlBlock->state = MAMOS_BLOCKED_TASK;
-    a_ptr2taskControlBlock->delayTicks += G_kernelControlPanel.ticksCounter;
-    MamOS_addToQueue(&G_kernelControlPanel.blockedQueue, MAMOS_DELAY_COMPARATOR_ID, a_ptr2taskControlBlock);
+    if(a_ptr2taskControlBlock->delayTicks == 0)
+    {
+        /* A zero delay has already expired, So the task is just moved back to the ready queue. */
+        MamOS_addToReadyQueue(a_ptr2taskControlBlock);
+    }
+
+    else
+    {
+        MamOS_QueueType* LOC_ptr2wheelSlot = NULL_PTR;
+
+        G_kernelControlPanel.blockEmptyFlag = FALSE;
+        a_ptr2taskControlBlock->state = MAMOS_BLOCKED_TASK;
+        /* Convert the delay to an absolute wake-up tick [limited to keep the tick comparisons wrap-safe]. */
+        if(a_ptr2taskControlBlock->delayTicks > MAMOS_MAX_DELAY_TICKS) a_ptr2taskControlBlock->delayTicks = MAMOS_MAX_DELAY_TICKS;
+        a_ptr2taskControlBlock->delayTicks += (uint32)G_kernelControlPanel.ticksCounter;
+
+        /* Link the task at the rear of the wheel slot of its wake-up tick [no ordering is needed]. */
+        LOC_ptr2wheelSlot = &G_kernelControlPanel.blockedQueue.wheelSlots[MAMOS_GET_WHEEL_SLOT(a_ptr2taskControlBlock->delayTicks)];
+        a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
+        a_ptr2taskControlBlock->ptr2prevTask = LOC_ptr2wheelSlot->ptr2rearTask;
+
+        if(LOC_ptr2wheelSlot->ptr2headTask == NULL_PTR) LOC_ptr2wheelSlot->ptr2headTask = a_ptr2taskControlBlock;
+        else LOC_ptr2wheelSlot->ptr2rearTask->ptr2nextTask = a_ptr2taskControlBlock;
+
+        LOC_ptr2wheelSlot->ptr2rearTask = a_ptr2taskControlBlock;
+        G_kernelControlPanel.blockedQueue.queueSize++;
+    }
 }
 
 /*=====================================================================================================================
@@ -86,44 +338,193 @@ void MamOS_addToBlockedQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
  ====================================================================================================================*/
 void MamOS_removeFromBlockedQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
 {
-    MamOS_removeFromQueue(&G_kernelControlPanel.blockedQueue, a_ptr2taskControlBlock);
+    MamOS_QueueType* LOC_ptr2wheelSlot = &G_kernelControlPanel.blockedQueue.wheelSlots[MAMOS_GET_WHEEL_SLOT(a_ptr2taskControlBlock->delayTicks)];
+
+    /* Unlink the task from its wheel slot [no search is needed as the slot list is doubly linked]. */
+    if(a_ptr2taskControlBlock->ptr2prevTask == NULL_PTR) LOC_ptr2wheelSlot->ptr2headTask = a_ptr2taskControlBlock->ptr2nextTask;
+    else a_ptr2taskControlBlock->ptr2prevTask->ptr2nextTask = a_ptr2taskControlBlock->ptr2nextTask;
+
+    if(a_ptr2taskControlBlock->ptr2nextTask == NULL_PTR) LOC_ptr2wheelSlot->ptr2rearTask = a_ptr2taskControlBlock->ptr2prevTask;
+    else a_ptr2taskControlBlock->ptr2nextTask->ptr2prevTask = a_ptr2taskControlBlock->ptr2prevTask;
 
-    /* If the blocked queue is empty after removing the task, set the flag and reset the tick counter. */
-    if(G_kernelControlPanel.blockedQueue.ptr2headTask == NULL_PTR)
+    a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
+    a_ptr2taskControlBlock->ptr2prevTask = NULL_PTR;
+    G_kernelControlPanel.blockedQueue.queueSize--;
+
+    /* If the blocked queue is empty after removing the task, set the flag [the tick counter keeps counting]. */
+    if(G_kernelControlPanel.blockedQueue.queueSize == 0)
     {
         G_kernelControlPanel.blockEmptyFlag = TRUE;
-        G_kernelControlPanel.ticksCounter = 0;
     }
 }
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_addToWaitingQueue
- * [Description]   : Adds a specific task to the waiting queue of a specific mutex and change its state.
- * [Arguments]     : <a_ptr2mutex>            -> Pointer to the mutex.
+ * [Description]   : Adds a specific task to a specific waiting queue ordered by priority and change its state,
+ *                   The task is also added to the blocked queue to wake it up if the wait times out.
+ * [Arguments]     : <a_ptr2waitingQueue>     -> Pointer to the waiting queue [of a mutex, a message queue, etc],
+ *                                               Or Null Pointer if the task waits for a direct notification.
  *                   <a_ptr2taskControlBlock> -> Pointer to the task to be added to the waiting queue.
+ *                   <a_timeoutTicks>         -> Indicates to the maximum waiting time [in ticks, non-zero], Or
+ *                                               MAMOS_WAIT_FOREVER to wait without a timeout.
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_addToWaitingQueue(MamOS_mutexHandle a_ptr2mutex, MamOS_taskControlBlockType* a_ptr2taskControlBlock)
+void MamOS_addToWaitingQueue(MamOS_QueueType* a_ptr2waitingQueue, MamOS_taskControlBlockType* a_ptr2taskControlBlock, uint32 a_timeoutTicks)
 {
+    /* A timed wait also links the task in the blocked queue, So the tick wakes it up if it's never signaled. */
+    if(a_timeoutTicks != MAMOS_WAIT_FOREVER)
+    {
+        a_ptr2taskControlBlock->delayTicks = a_timeoutTicks;
+        MamOS_addToBlockedQueue(a_ptr2taskControlBlock);
+        a_ptr2taskControlBlock->timedWaitFlag = TRUE;
+    }
+
+    else
+    {
+        a_ptr2taskControlBlock->timedWaitFlag = FALSE;
+    }
+
     a_ptr2taskControlBlock->state = MAMOS_WAITING_TASK;
-    MamOS_addToQueue(&a_ptr2mutex->waitingQueue, MAMOS_PRIORITY_COMPARATOR_ID, a_ptr2taskControlBlock);
+    a_ptr2taskControlBlock->waitResult = FALSE;
+    a_ptr2taskControlBlock->ptr2waitingQueue = a_ptr2waitingQueue;
+
+    if(a_ptr2waitingQueue != NULL_PTR)
+    {
+        MamOS_addToQueue(a_ptr2waitingQueue, MAMOS_PRIORITY_COMPARATOR_ID, a_ptr2taskControlBlock);
+    }
 }
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_removeFromWaitingQueue
- * [Description]   : Removes a specific task from the waiting queue of a specific mutex.
- * [Arguments]     : <a_ptr2mutex>            -> Pointer to the mutex.
- *                   <a_ptr2taskControlBlock> -> Pointer to the task to be removed from the waiting queue.
+ * [Description]   : Removes a specific task from the waiting queue that holds it.
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the task to be removed from the waiting queue.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_removeFromWaitingQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
+{
+    if(a_ptr2taskControlBlock->ptr2waitingQueue == NULL_PTR)
+    {
+        /* Invalid Operation [the task is not linked in a waiting queue]. */
+    }
+
+    else
+    {
+        MamOS_removeFromQueue(a_ptr2taskControlBlock->ptr2waitingQueue, a_ptr2taskControlBlock);
+        a_ptr2taskControlBlock->ptr2waitingQueue = NULL_PTR;
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_wakeFromWaitingQueue
+ * [Description]   : Wakes a specific waiting task up after its wait is satisfied, Removing it from its waiting
+ *                   queue [and from the blocked queue if its wait is timed], Then adding it to the ready queue.
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the task to be woken up.
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_removeFromWaitingQueue(MamOS_mutexHandle a_ptr2mutex, MamOS_taskControlBlockType* a_ptr2taskControlBlock)
+void MamOS_wakeFromWaitingQueue(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
 {
-    MamOS_removeFromQueue(&a_ptr2mutex->waitingQueue, a_ptr2taskControlBlock);
+    MamOS_removeFromWaitingQueue(a_ptr2taskControlBlock);
+
+    if(a_ptr2taskControlBlock->timedWaitFlag == TRUE)
+    {
+        MamOS_removeFromBlockedQueue(a_ptr2taskControlBlock);
+        a_ptr2taskControlBlock->timedWaitFlag = FALSE;
+    }
+
+    a_ptr2taskControlBlock->waitResult = TRUE;
+    MamOS_addToReadyQueue(a_ptr2taskControlBlock);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_cancelWait
+ * [Description]   : Cancels the wait of a specific task without satisfying it, Removing it from its waiting queue
+ *                   [and from the blocked queue if its wait is timed], So its wait result stays FALSE.
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the waiting task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_cancelWait(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
+{
+    MamOS_removeFromWaitingQueue(a_ptr2taskControlBlock);
+
+    if(a_ptr2taskControlBlock->timedWaitFlag == TRUE)
+    {
+        MamOS_removeFromBlockedQueue(a_ptr2taskControlBlock);
+        a_ptr2taskControlBlock->timedWaitFlag = FALSE;
+    }
+
+    if(a_ptr2taskControlBlock->notificationState == MAMOS_NOTIFICATION_WAITING)
+    {
+        a_ptr2taskControlBlock->notificationState = MAMOS_NOTIFICATION_NONE;
+    }
+
+    a_ptr2taskControlBlock->waitResult = FALSE;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_changeTaskPriority
+ * [Description]   : Changes the priority of a specific task, Repositioning it in the ready queue or in its waiting
+ *                   queue [if it's linked in any of them].
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the required task.
+ *                   <a_priority>             -> Indicates to the new task priority [0 ~ 255].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_changeTaskPriority(MamOS_taskControlBlockType* a_ptr2taskControlBlock, uint8 a_priority)
+{
+    if(a_ptr2taskControlBlock->state == MAMOS_READY_TASK)
+    {
+        MamOS_removeFromReadyQueue(a_ptr2taskControlBlock);
+        a_ptr2taskControlBlock->priority = a_priority;
+        MamOS_addToReadyQueue(a_ptr2taskControlBlock);
+    }
+
+    else if((a_ptr2taskControlBlock->state == MAMOS_WAITING_TASK) && (a_ptr2taskControlBlock->ptr2waitingQueue != NULL_PTR))
+    {
+        MamOS_removeFromQueue(a_ptr2taskControlBlock->ptr2waitingQueue, a_ptr2taskControlBlock);
+        a_ptr2taskControlBlock->priority = a_priority;
+        MamOS_addToQueue(a_ptr2taskControlBlock->ptr2waitingQueue, MAMOS_PRIORITY_COMPARATOR_ID, a_ptr2taskControlBlock);
+    }
+
+    else
+    {
+        /* The task is not linked in a priority ordered queue, So the new priority applies when it's linked. */
+        a_ptr2taskControlBlock->priority = a_priority;
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_addToDeadlineList
+ * [Description]   : Adds a specific periodic task to the ready queue deadline list ordered by its absolute deadline.
+ * [Arguments]     : <a_ptr2taskControlBlock> -> Pointer to the task to be added to the deadline list.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+#if (MAMOS_SCHEDULING_POLICY == MAMOS_EDF_POLICY)
+static void MamOS_addToDeadlineList(MamOS_taskControlBlockType* a_ptr2taskControlBlock)
+{
+    MamOS_QueueType* LOC_ptr2deadlineList = &G_kernelControlPanel.readyQueue.deadlineList;
+    MamOS_taskControlBlockType* LOC_ptr2nextTask = LOC_ptr2deadlineList->ptr2headTask;
+
+    /* Find the first task with a later deadline [equal deadlines keep FIFO order]. */
+    while((LOC_ptr2nextTask != NULL_PTR) && !MAMOS_DEADLINE_IS_BEFORE(a_ptr2taskControlBlock->deadline, LOC_ptr2nextTask->deadline))
+    {
+        LOC_ptr2nextTask = LOC_ptr2nextTask->ptr2nextTask;
+    }
+
+    /* Link the task before that task, Or at the rear of the list if there is no later deadline. */
+    a_ptr2taskControlBlock->ptr2nextTask = LOC_ptr2nextTask;
+    a_ptr2taskControlBlock->ptr2prevTask = (LOC_ptr2nextTask == NULL_PTR) ? LOC_ptr2deadlineList->ptr2rearTask : LOC_ptr2nextTask->ptr2prevTask;
+
+    if(LOC_ptr2nextTask == NULL_PTR) LOC_ptr2deadlineList->ptr2rearTask = a_ptr2taskControlBlock;
+    else LOC_ptr2nextTask->ptr2prevTask = a_ptr2taskControlBlock;
+
+    if(a_ptr2taskControlBlock->ptr2prevTask == NULL_PTR) LOC_ptr2deadlineList->ptr2headTask = a_ptr2taskControlBlock;
+    else a_ptr2taskControlBlock->ptr2prevTask->ptr2nextTask = a_ptr2taskControlBlock;
+}
+#endif
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_addToQueue
- * [Description]   : Adds a specific task to a specific queue.
+ * [Description]   : Adds a specific task to a specific waiting queue [linked by its own waiting link, So the
+ *                   task can be linked in the blocked queue at the same time].
  * [Arguments]     : <a_ptr2queue>            -> Pointer to the required queue.
  *                   <a_comparator>           -> Type of comparison when adding the task (priority or delay).
  *                   <a_ptr2taskControlBlock> -> Pointer to the task to be added to the queue.
@@ -134,7 +535,7 @@ static void MamOS_addToQueue(MamOS_QueueType* a_ptr2queue, uint8 a_comparator, M
     /* Handle empty queue case. */
     if(a_ptr2queue->ptr2headTask == NULL_PTR)
     {
-        a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
+        a_ptr2taskControlBlock->ptr2nextWaitingTask = NULL_PTR;
         a_ptr2queue->ptr2headTask = a_ptr2taskControlBlock;
         a_ptr2queue->ptr2rearTask = a_ptr2taskControlBlock;
     }
@@ -142,15 +543,15 @@ static void MamOS_addToQueue(MamOS_QueueType* a_ptr2queue, uint8 a_comparator, M
     /* Handle insertion at head if new task has higher priority/earlier deadline. */
     else if(MAMOS_GET_COMPARATOR_VALUE(a_ptr2queue->ptr2headTask, a_comparator) > MAMOS_GET_COMPARATOR_VALUE(a_ptr2taskControlBlock, a_comparator))
     {
-        a_ptr2taskControlBlock->ptr2nextTask = a_ptr2queue->ptr2headTask;
+        a_ptr2taskControlBlock->ptr2nextWaitingTask = a_ptr2queue->ptr2headTask;
         a_ptr2queue->ptr2headTask = a_ptr2taskControlBlock;
     }
 
     /* Handle single element queue case. */
-    else if(a_ptr2queue->ptr2headTask->ptr2nextTask == NULL_PTR)
+    else if(a_ptr2queue->ptr2headTask->ptr2nextWaitingTask == NULL_PTR)
     {
-        a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
-        a_ptr2queue->ptr2headTask->ptr2nextTask = a_ptr2taskControlBlock;
+        a_ptr2taskControlBlock->ptr2nextWaitingTask = NULL_PTR;
+        a_ptr2queue->ptr2headTask->ptr2nextWaitingTask = a_ptr2taskControlBlock;
     }
 
     /* Handle general case [insert in middle or end]. */
@@ -159,33 +560,33 @@ static void MamOS_addToQueue(MamOS_QueueType* a_ptr2queue, uint8 a_comparator, M
         MamOS_taskControlBlockType* LOC_currentTask = a_ptr2queue->ptr2headTask;
 
         /* Find insertion point. */
-        while(LOC_currentTask->ptr2nextTask != NULL_PTR)
+        while(LOC_currentTask->ptr2nextWaitingTask != NULL_PTR)
         {
-            if(MAMOS_GET_COMPARATOR_VALUE(LOC_currentTask->ptr2nextTask, a_comparator) > MAMOS_GET_COMPARATOR_VALUE(a_ptr2taskControlBlock, a_comparator))
+            if(MAMOS_GET_COMPARATOR_VALUE(LOC_currentTask->ptr2nextWaitingTask, a_comparator) > MAMOS_GET_COMPARATOR_VALUE(a_ptr2taskControlBlock, a_comparator))
             {
-                a_ptr2taskControlBlock->ptr2nextTask = LOC_currentTask->ptr2nextTask;
-                LOC_currentTask->ptr2nextTask = a_ptr2taskControlBlock;
+                a_ptr2taskControlBlock->ptr2nextWaitingTask = LOC_currentTask->ptr2nextWaitingTask;
+                LOC_currentTask->ptr2nextWaitingTask = a_ptr2taskControlBlock;
                 break;
             }
 
             else
             {
-                LOC_currentTask = LOC_currentTask->ptr2nextTask;
+                LOC_currentTask = LOC_currentTask->ptr2nextWaitingTask;
             }
         }
         
         /* Insert at end if no suitable position found. */
-        if(LOC_currentTask->ptr2nextTask == NULL_PTR)
+        if(LOC_currentTask->ptr2nextWaitingTask == NULL_PTR)
         {
-            a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
-            LOC_currentTask->ptr2nextTask = a_ptr2taskControlBlock;
+            a_ptr2taskControlBlock->ptr2nextWaitingTask = NULL_PTR;
+            LOC_currentTask->ptr2nextWaitingTask = a_ptr2taskControlBlock;
         }
     }
 }
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_removeFromQueue
- * [Description]   : Removes a specific task from a specific queue.
+ * [Description]   : Removes a specific task from a specific waiting queue.
  * [Arguments]     : <a_ptr2queue>            -> Pointer to the required queue.
  *                   <a_ptr2taskControlBlock> -> Pointer to the task to be removed from the queue.
  * [return]        : The function returns void.
@@ -201,8 +602,8 @@ static void MamOS_removeFromQueue(MamOS_QueueType* a_ptr2queue, MamOS_taskContro
     /* Handle removing head case. */
     else if(a_ptr2queue->ptr2headTask == a_ptr2taskControlBlock)
     {
-        a_ptr2queue->ptr2headTask = a_ptr2queue->ptr2headTask->ptr2nextTask;
-        a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
+        a_ptr2queue->ptr2headTask = a_ptr2queue->ptr2headTask->ptr2nextWaitingTask;
+        a_ptr2taskControlBlock->ptr2nextWaitingTask = NULL_PTR;
     }
 
     /* Handle removing from middle/end. */
@@ -210,19 +611,19 @@ static void MamOS_removeFromQueue(MamOS_QueueType* a_ptr2queue, MamOS_taskContro
     {
         MamOS_taskControlBlockType* LOC_currentTask = a_ptr2queue->ptr2headTask;
 
-        while(LOC_currentTask->ptr2nextTask != NULL_PTR)
+        while(LOC_currentTask->ptr2nextWaitingTask != NULL_PTR)
         {
-            if(LOC_currentTask->ptr2nextTask == a_ptr2taskControlBlock)
+            if(LOC_currentTask->ptr2nextWaitingTask == a_ptr2taskControlBlock)
             {
                 /* Remove task by updating links. */
-                LOC_currentTask->ptr2nextTask = LOC_currentTask->ptr2nextTask->ptr2nextTask;
-                a_ptr2taskControlBlock->ptr2nextTask = NULL_PTR;
+                LOC_currentTask->ptr2nextWaitingTask = LOC_currentTask->ptr2nextWaitingTask->ptr2nextWaitingTask;
+                a_ptr2taskControlBlock->ptr2nextWaitingTask = NULL_PTR;
                 break;
             }
 
             else
             {
-                LOC_currentTask = LOC_currentTask->ptr2nextTask;
+                LOC_currentTask = LOC_currentTask->ptr2nextWaitingTask;
             }
         }
     }
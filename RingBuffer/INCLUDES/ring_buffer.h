@@ -0,0 +1,72 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Ring Buffer
+File Name    : ring_buffer.h
+Date Created : Oct 17, 2026
+Description  : Interface file for the MamOS Ring Buffer module.
+=======================================================================================================================
+*/
+
+
+#ifndef MAMOS_RINGBUFFER_INCLUDES_RING_BUFFER_H_
+#define MAMOS_RINGBUFFER_INCLUDES_RING_BUFFER_H_
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createRingBuffer
+ * [Description]   : Creates a new single-producer/single-consumer ring buffer in the MamOS.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the ring buffer [supplied by the user].
+ *                   <a_capacity>         -> Indicates to the storage buffer size [in bytes, a power of two].
+ * [return]        : The function returns the handle to the created ring buffer [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_ringBufferHandle MamOS_createRingBuffer(uint8* a_ptr2storage, uint32 a_capacity);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_writeRingBuffer
+ * [Description]   : Writes data to a specific ring buffer from the producer task without blocking, Then wakes the
+ *                   consumer task up if it's waiting for data [wait-free unless the consumer is waiting].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to the data to be written.
+ *                   <a_length>           -> Indicates to the data length [in bytes].
+ * [return]        : The function returns the number of written bytes [less than the length if the ring is full].
+ ====================================================================================================================*/
+uint32 MamOS_writeRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, const uint8* a_ptr2data, uint32 a_length);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_writeRingBufferFromISR
+ * [Description]   : Writes data to a specific ring buffer from the producer interrupt without blocking, The context
+ *                   switch to the woken consumer task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to the data to be written.
+ *                   <a_length>           -> Indicates to the data length [in bytes].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    consumer task precedes the task going to run next.
+ * [return]        : The function returns the number of written bytes [less than the length if the ring is full].
+ ====================================================================================================================*/
+uint32 MamOS_writeRingBufferFromISR(MamOS_ringBufferHandle a_ptr2ringBuffer, const uint8* a_ptr2data, uint32 a_length, uint8* a_ptr2higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_readRingBuffer
+ * [Description]   : Reads the available data from a specific ring buffer by the consumer task, The task is blocked
+ *                   only while the ring is empty.
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to a buffer to store the read data.
+ *                   <a_length>           -> Indicates to the maximum data length to be read [in bytes].
+ * [return]        : The function returns the number of read bytes [at least one byte if the length is not zero].
+ ====================================================================================================================*/
+uint32 MamOS_readRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, uint8* a_ptr2data, uint32 a_length);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_releaseTaskRingBuffers
+ * [Description]   : Releases the ring buffers a task being deleted or suspended waits for, So no producer wakes it
+ *                   up while it's suspended or after its task control block is reused [called inside a kernel call].
+ * [Arguments]     : <a_ptr2task>         -> Pointer to the task that stops waiting.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_releaseTaskRingBuffers(MamOS_taskControlBlockType* a_ptr2task);
+
+#endif /* MAMOS_RINGBUFFER_INCLUDES_RING_BUFFER_H_ */
@@ -0,0 +1,64 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Ring Buffer
+File Name    : ring_buffer_prv.h
+Date Created : Oct 17, 2026
+Description  : Private file for the MamOS Ring Buffer module.
+=======================================================================================================================
+*/
+
+
+#ifndef MAMOS_RINGBUFFER_INCLUDES_RING_BUFFER_PRV_H_
+#define MAMOS_RINGBUFFER_INCLUDES_RING_BUFFER_PRV_H_
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_copyToRingBuffer
+ * [Description]   : Copies data into the free space of a ring buffer, Then publishes it to the consumer [lock-free].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to the data to be written.
+ *                   <a_length>           -> Indicates to the data length [in bytes].
+ * [return]        : The function returns the number of written bytes.
+ ====================================================================================================================*/
+static uint32 MamOS_copyToRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, const uint8* a_ptr2data, uint32 a_length);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_copyFromRingBuffer
+ * [Description]   : Copies the available data out of a ring buffer, Then frees its space for the producer [lock-free].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to a buffer to store the read data.
+ *                   <a_length>           -> Indicates to the maximum data length to be read [in bytes].
+ * [return]        : The function returns the number of read bytes.
+ ====================================================================================================================*/
+static uint32 MamOS_copyFromRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, uint8* a_ptr2data, uint32 a_length);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_wakeRingBufferConsumer
+ * [Description]   : Moves the consumer task waiting for data to the ready queue [called inside a critical section].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ * [return]        : The function returns TRUE if the woken task precedes the task going to run next, FALSE otherwise.
+ ====================================================================================================================*/
+static uint8 MamOS_wakeRingBufferConsumer(MamOS_ringBufferHandle a_ptr2ringBuffer);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_wakeRingBufferCall
+ * [Description]   : Wakes the consumer task up and switches to it if it precedes the producer task [runs inside a
+ *                   kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the required ring buffer.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_wakeRingBufferCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitRingBufferCall
+ * [Description]   : Blocks the consumer task while the ring buffer is empty [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the required ring buffer.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_waitRingBufferCall(void* a_ptr2argument);
+
+#endif /* MAMOS_RINGBUFFER_INCLUDES_RING_BUFFER_PRV_H_ */
@@ -0,0 +1,300 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Ring Buffer
+File Name    : ring_buffer.c
+Date Created : Oct 17, 2026
+Description  : Source file for the MamOS Ring Buffer module.
+=======================================================================================================================
+*/
+
+
+/*=====================================================================================================================
+ * [Details]     : This module hosts the single-producer/single-consumer ring buffers of the MamOS, They pass
+ *                 a stream of bytes from an interrupt [or a task] to a task without locks. The producer and the
+ *                 consumer only modify their own index, So the data transfer is wait-free, and the consumer
+ *                 task is blocked only while the ring is empty.
+ ====================================================================================================================*/
+
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+#include "../../Others/std_types.h"
+#include "../../Others/kernel_defs.h"
+#include "../../Queue/INCLUDES/queue.h"
+#include "../../Scheduler/INCLUDES/scheduler.h"
+#include "../../Core/INCLUDES/core.h"
+#include "../INCLUDES/ring_buffer_prv.h"
+#include "../INCLUDES/ring_buffer.h"
+
+/*=====================================================================================================================
+                                           < Global Variables >
+=====================================================================================================================*/
+
+/* Array of ring buffers that available in the system. */
+volatile MamOS_ringBufferType G_ringBufferHeap[MAMOS_MAX_NUM_OF_RING_BUFFERS] = {0};
+
+/* Extern the Kernel Control Panel. */
+extern MamOS_kernelControlPanelType G_kernelControlPanel;
+
+/*=====================================================================================================================
+                                          < Functions Definitions >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createRingBuffer
+ * [Description]   : Creates a new single-producer/single-consumer ring buffer in the MamOS.
+ * [Arguments]     : <a_ptr2storage>      -> Pointer to the storage buffer of the ring buffer [supplied by the user].
+ *                   <a_capacity>         -> Indicates to the storage buffer size [in bytes, a power of two].
+ * [return]        : The function returns the handle to the created ring buffer [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_ringBufferHandle MamOS_createRingBuffer(uint8* a_ptr2storage, uint32 a_capacity)
+{
+    MamOS_ringBufferHandle LOC_createdRingBufferHandle = NULL_PTR;
+
+    if(G_kernelControlPanel.ringBufferCounter >= MAMOS_MAX_NUM_OF_RING_BUFFERS)
+    {
+        /* Invalid Operation. */
+    }
+
+    else if(a_ptr2storage == NULL_PTR)
+    {
+        /* Invalid Operation. */
+    }
+
+    else if((a_capacity == 0) || ((a_capacity & (a_capacity - 1)) != 0))
+    {
+        /* Invalid Operation [the indices are wrapped by masking, So the capacity must be a power of two]. */
+    }
+
+    else
+    {
+        /* Get the handle of the created ring buffer and increment the ring buffer counter. */
+        LOC_createdRingBufferHandle = &G_ringBufferHeap[G_kernelControlPanel.ringBufferCounter];
+        G_kernelControlPanel.ringBufferCounter++;
+
+        /* Initialize the new ring buffer. */
+        LOC_createdRingBufferHandle->writeIndex = 0;
+        LOC_createdRingBufferHandle->readIndex = 0;
+        LOC_createdRingBufferHandle->indexMask = a_capacity - 1;
+        LOC_createdRingBufferHandle->ptr2storage = a_ptr2storage;
+        LOC_createdRingBufferHandle->ptr2waitingTask = NULL_PTR;
+    }
+
+    return LOC_createdRingBufferHandle;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_writeRingBuffer
+ * [Description]   : Writes data to a specific ring buffer from the producer task without blocking, Then wakes the
+ *                   consumer task up if it's waiting for data [wait-free unless the consumer is waiting].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to the data to be written.
+ *                   <a_length>           -> Indicates to the data length [in bytes].
+ * [return]        : The function returns the number of written bytes [less than the length if the ring is full].
+ ====================================================================================================================*/
+uint32 MamOS_writeRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, const uint8* a_ptr2data, uint32 a_length)
+{
+    uint32 LOC_writtenBytes = MamOS_copyToRingBuffer(a_ptr2ringBuffer, a_ptr2data, a_length);
+
+    /* The producer pays for the kernel call only if the consumer is actually waiting for data. */
+    if((LOC_writtenBytes != 0) && (a_ptr2ringBuffer->ptr2waitingTask != NULL_PTR))
+    {
+        MamOS_kernelCall(MamOS_wakeRingBufferCall, a_ptr2ringBuffer);
+    }
+
+    return LOC_writtenBytes;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_writeRingBufferFromISR
+ * [Description]   : Writes data to a specific ring buffer from the producer interrupt without blocking, The context
+ *                   switch to the woken consumer task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to the data to be written.
+ *                   <a_length>           -> Indicates to the data length [in bytes].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    consumer task precedes the task going to run next.
+ * [return]        : The function returns the number of written bytes [less than the length if the ring is full].
+ ====================================================================================================================*/
+uint32 MamOS_writeRingBufferFromISR(MamOS_ringBufferHandle a_ptr2ringBuffer, const uint8* a_ptr2data, uint32 a_length, uint8* a_ptr2higherPriorityTaskWoken)
+{
+    uint32 LOC_writtenBytes = MamOS_copyToRingBuffer(a_ptr2ringBuffer, a_ptr2data, a_length);
+
+    /* The producer pays for the critical section only if the consumer is actually waiting for data. */
+    if((LOC_writtenBytes != 0) && (a_ptr2ringBuffer->ptr2waitingTask != NULL_PTR))
+    {
+        MamOS_enterCritical();
+
+        if((MamOS_wakeRingBufferConsumer(a_ptr2ringBuffer) == TRUE) && (a_ptr2higherPriorityTaskWoken != NULL_PTR))
+        {
+            *a_ptr2higherPriorityTaskWoken = TRUE;
+        }
+
+        MamOS_exitCritical();
+    }
+
+    return LOC_writtenBytes;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_readRingBuffer
+ * [Description]   : Reads the available data from a specific ring buffer by the consumer task, The task is blocked
+ *                   only while the ring is empty.
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to a buffer to store the read data.
+ *                   <a_length>           -> Indicates to the maximum data length to be read [in bytes].
+ * [return]        : The function returns the number of read bytes [at least one byte if the length is not zero].
+ ====================================================================================================================*/
+uint32 MamOS_readRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, uint8* a_ptr2data, uint32 a_length)
+{
+    uint32 LOC_readBytes = 0;
+
+    if(a_length != 0)
+    {
+        /* Block only while the ring is empty, The data is re-checked after every wake-up. */
+        LOC_readBytes = MamOS_copyFromRingBuffer(a_ptr2ringBuffer, a_ptr2data, a_length);
+
+        while(LOC_readBytes == 0)
+        {
+            MamOS_kernelCall(MamOS_waitRingBufferCall, a_ptr2ringBuffer);
+            LOC_readBytes = MamOS_copyFromRingBuffer(a_ptr2ringBuffer, a_ptr2data, a_length);
+        }
+    }
+
+    return LOC_readBytes;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_releaseTaskRingBuffers
+ * [Description]   : Releases the ring buffers a task being deleted or suspended waits for, So no producer wakes it
+ *                   up while it's suspended or after its task control block is reused [called inside a kernel call].
+ * [Arguments]     : <a_ptr2task>         -> Pointer to the task that stops waiting.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_releaseTaskRingBuffers(MamOS_taskControlBlockType* a_ptr2task)
+{
+    for(uint8 iterator = 0; iterator < G_kernelControlPanel.ringBufferCounter; iterator++)
+    {
+        if(G_ringBufferHeap[iterator].ptr2waitingTask == a_ptr2task)
+        {
+            G_ringBufferHeap[iterator].ptr2waitingTask = NULL_PTR;
+        }
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_copyToRingBuffer
+ * [Description]   : Copies data into the free space of a ring buffer, Then publishes it to the consumer [lock-free].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to the data to be written.
+ *                   <a_length>           -> Indicates to the data length [in bytes].
+ * [return]        : The function returns the number of written bytes.
+ ====================================================================================================================*/
+static uint32 MamOS_copyToRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, const uint8* a_ptr2data, uint32 a_length)
+{
+    uint32 LOC_writeIndex = a_ptr2ringBuffer->writeIndex;
+    uint32 LOC_freeBytes = (a_ptr2ringBuffer->indexMask + 1) - (LOC_writeIndex - a_ptr2ringBuffer->readIndex);
+    uint32 LOC_writtenBytes = (a_length < LOC_freeBytes) ? a_length : LOC_freeBytes;
+
+    /* Make sure the consumer finished reading the freed space before overwriting it. */
+    MAMOS_MEMORY_BARRIER();
+
+    for(uint32 counter = 0; counter < LOC_writtenBytes; counter++)
+    {
+        a_ptr2ringBuffer->ptr2storage[(LOC_writeIndex + counter) & a_ptr2ringBuffer->indexMask] = a_ptr2data[counter];
+    }
+
+    /* Make sure the data is stored before publishing the new write index to the consumer. */
+    MAMOS_MEMORY_BARRIER();
+    a_ptr2ringBuffer->writeIndex = LOC_writeIndex + LOC_writtenBytes;
+
+    return LOC_writtenBytes;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_copyFromRingBuffer
+ * [Description]   : Copies the available data out of a ring buffer, Then frees its space for the producer [lock-free].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ *                   <a_ptr2data>         -> Pointer to a buffer to store the read data.
+ *                   <a_length>           -> Indicates to the maximum data length to be read [in bytes].
+ * [return]        : The function returns the number of read bytes.
+ ====================================================================================================================*/
+static uint32 MamOS_copyFromRingBuffer(MamOS_ringBufferHandle a_ptr2ringBuffer, uint8* a_ptr2data, uint32 a_length)
+{
+    uint32 LOC_readIndex = a_ptr2ringBuffer->readIndex;
+    uint32 LOC_availableBytes = a_ptr2ringBuffer->writeIndex - LOC_readIndex;
+    uint32 LOC_readBytes = (a_length < LOC_availableBytes) ? a_length : LOC_availableBytes;
+
+    /* Make sure the data is read only after reading the write index that published it. */
+    MAMOS_MEMORY_BARRIER();
+
+    for(uint32 counter = 0; counter < LOC_readBytes; counter++)
+    {
+        a_ptr2data[counter] = a_ptr2ringBuffer->ptr2storage[(LOC_readIndex + counter) & a_ptr2ringBuffer->indexMask];
+    }
+
+    /* Make sure the data is read before freeing its space to the producer. */
+    MAMOS_MEMORY_BARRIER();
+    a_ptr2ringBuffer->readIndex = LOC_readIndex + LOC_readBytes;
+
+    return LOC_readBytes;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_wakeRingBufferConsumer
+ * [Description]   : Moves the consumer task waiting for data to the ready queue [called inside a critical section].
+ * [Arguments]     : <a_ptr2ringBuffer>   -> Pointer to the required ring buffer.
+ * [return]        : The function returns TRUE if the woken task precedes the task going to run next, FALSE otherwise.
+ ====================================================================================================================*/
+static uint8 MamOS_wakeRingBufferConsumer(MamOS_ringBufferHandle a_ptr2ringBuffer)
+{
+    uint8 LOC_precedingFlag = FALSE;
+    MamOS_taskControlBlockType* LOC_ptr2waitingTask = a_ptr2ringBuffer->ptr2waitingTask;
+
+    /* The consumer may have been woken up already by a nested producer call. */
+    if(LOC_ptr2waitingTask != NULL_PTR)
+    {
+        a_ptr2ringBuffer->ptr2waitingTask = NULL_PTR;
+        MamOS_addToReadyQueue(LOC_ptr2waitingTask);
+        LOC_precedingFlag = MamOS_isTaskPreceding(LOC_ptr2waitingTask, G_kernelControlPanel.ptr2standbyTask);
+    }
+
+    return LOC_precedingFlag;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_wakeRingBufferCall
+ * [Description]   : Wakes the consumer task up and switches to it if it precedes the producer task [runs inside a
+ *                   kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the required ring buffer.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_wakeRingBufferCall(void* a_ptr2argument)
+{
+    MamOS_yieldFromISR(MamOS_wakeRingBufferConsumer((MamOS_ringBufferHandle)a_ptr2argument));
+
+    return 0;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitRingBufferCall
+ * [Description]   : Blocks the consumer task while the ring buffer is empty [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the required ring buffer.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_waitRingBufferCall(void* a_ptr2argument)
+{
+    MamOS_ringBufferHandle LOC_ptr2ringBuffer = a_ptr2argument;
+
+    /* The producer interrupts are masked here, So the data can't arrive between this check and the blocking. */
+    if(LOC_ptr2ringBuffer->writeIndex == LOC_ptr2ringBuffer->readIndex)
+    {
+        LOC_ptr2ringBuffer->ptr2waitingTask = G_kernelControlPanel.ptr2activeTask;
+        G_kernelControlPanel.ptr2activeTask->state = MAMOS_WAITING_TASK;
+        MamOS_forceTaskTransition();
+    }
+
+    return 0;
+}
@@ -19,7 +19,8 @@ Description  : Interface file for the MamOS Scheduler module.
 /*=====================================================================================================================
  * [Function Name] : MamOS_schedulerTick
  * [Description]   : Called every system tick to update the blocked queue, and make a context switch
- *                   if the system is preemptive and there is a higher priority task.
+ *                   if the system is preemptive and there is a higher priority task [or an equal priority
+ *                   task after the active task consumes its time slice].
  * [Arguments]     : The function Takes no arguments.
  * [return]        : The function returns void.
  ====================================================================================================================*/
@@ -33,4 +34,53 @@ void MamOS_schedulerTick(void);
  ====================================================================================================================*/
 void MamOS_forceTaskTransition(void);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_revokeStandbyTask
+ * [Description]   : Cancels a context switch that is still pending when the active task enters the kernel [the
+ *                   tick or a FromISR wake-up preempted the SVC handler before it masked them], The standby task
+ *                   goes back to the ready queue and the active task leaves it, So the caller finds the active
+ *                   task linked in no queue and the standby task never gets lost.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns TRUE if a pending switch is cancelled, FALSE otherwise.
+ ====================================================================================================================*/
+uint8 MamOS_revokeStandbyTask(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_forceTaskTransitionUntil
+ * [Description]   : Initiates an immediate context switch, Blocking the current task until its absolute release
+ *                   tick [the task is released immediately if its release tick has already passed].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_forceTaskTransitionUntil(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_yieldFromISR
+ * [Description]   : Requests a context switch at the end of an interrupt if a FromISR call woke up a task that
+ *                   precedes the task going to run next, The requests of the nested interrupts are coalesced
+ *                   into a single PendSV that runs after the last interrupt exits.
+ * [Arguments]     : <a_higherPriorityTaskWoken> -> Indicates whether a higher priority task was woken or not
+ *                                                  [the result collected from the FromISR calls].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_yieldFromISR(uint8 a_higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_yieldFromPendSV
+ * [Description]   : Selects a task woken inside the PendSV exception as the standby task if it precedes the task
+ *                   going to run next, The running PendSV switches to it, So PendSV is not triggered again.
+ * [Arguments]     : <a_higherPriorityTaskWoken> -> Indicates whether a higher priority task was woken or not.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_yieldFromPendSV(uint8 a_higherPriorityTaskWoken);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_enterTicklessIdle
+ * [Description]   : Suppresses the system ticks until the nearest wake-up in the blocked queue, Sleeps until
+ *                   any interrupt, Then corrects the system tick counter with the elapsed ticks.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_enterTicklessIdle(void);
+
 #endif /* MAMOS_SCHEDULER_INCLUDES_SCHEDULER_H_ */
@@ -18,10 +18,32 @@ Description  : Private file for the MamOS Scheduler module.
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_updateBlockedQueue
- * [Description]   : Updates the system tick counter and check if there are any expired delays.
+ * [Description]   : Checks if there are any expired delays in the blocked queue at the current system tick.
  * [Arguments]     : The function Takes no arguments.
  * [return]        : The function returns void.
  ====================================================================================================================*/
 static void MamOS_updateBlockedQueue(void);
 
+#if (MAMOS_PREEMPRIVE_SCHEDULER == TRUE)
+/*=====================================================================================================================
+ * [Function Name] : MamOS_preemptStandbyTask
+ * [Description]   : Selects a ready task to run next instead of the standby task and triggers PendSV, The standby
+ *                   task is the active task unless a switch is already pending, So repeated requests before PendSV
+ *                   runs only replace the selected task and the pending PendSV is triggered once.
+ * [Arguments]     : <a_ptr2readyTask>  -> Pointer to the ready task to run next.
+ *                   <a_pendSwitchFlag> -> Indicates whether PendSV is triggered or not [not inside PendSV].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_preemptStandbyTask(MamOS_taskControlBlockType* a_ptr2readyTask, uint8 a_pendSwitchFlag);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_selectPrecedingTask
+ * [Description]   : Selects the highest priority ready task as the standby task if it precedes the task going to
+ *                   run next [after a task is woken].
+ * [Arguments]     : <a_pendSwitchFlag> -> Indicates whether PendSV is triggered or not [not inside PendSV].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_selectPrecedingTask(uint8 a_pendSwitchFlag);
+#endif
+
 #endif /* MAMOS_SCHEDULER_INCLUDES_SCHEDULER_PRV_H_ */
@@ -20,8 +20,10 @@ Description  : Source file for the MamOS Scheduler module.
 
 #include "../../Others/std_types.h"
 #include "../../Others/kernel_defs.h"
+#include "../../Timer/INCLUDES/timer.h"
 #include "../../System/INCLUDES/system.h"
 #include "../../Queue/INCLUDES/queue.h"
+#include "../../Core/INCLUDES/core.h"
 #include "../INCLUDES/scheduler_prv.h"
 #include "../INCLUDES/scheduler.h"
 
@@ -39,37 +41,64 @@ extern MamOS_kernelControlPanelType G_kernelControlPanel;
 /*=====================================================================================================================
  * [Function Name] : MamOS_schedulerTick
  * [Description]   : Called every system tick to update the blocked queue, and make a context switch
- *                   if the system is preemptive and there is a higher priority task.
+ *                   if the system is preemptive and there is a higher priority task [or an equal priority
+ *                   task after the active task consumes its time slice].
  * [Arguments]     : The function Takes no arguments.
  * [return]        : The function returns void.
  ====================================================================================================================*/
 void MamOS_schedulerTick(void)
 {
+    MamOS_enterCritical();
+
+    G_kernelControlPanel.ticksCounter++;
+
     /* Update the blocked queue if it's not empty. */
     if(G_kernelControlPanel.blockEmptyFlag == FALSE)
     {
         MamOS_updateBlockedQueue();
     }
 
+    G_kernelControlPanel.checkedTick = (uint32)G_kernelControlPanel.ticksCounter;
+
     /* Check if the scheduler is preemptive. */
     #if (MAMOS_PREEMPRIVE_SCHEDULER == TRUE)
-    /* Check if there is a higher priority task in the ready queue. */
-    if(G_kernelControlPanel.readyQueue.ptr2headTask->priority <= G_kernelControlPanel.ptr2activeTask->priority)
-    {
-        /* Fetch the higher priority task from the ready queue. */
-        G_kernelControlPanel.ptr2standbyTask = G_kernelControlPanel.readyQueue.ptr2headTask;
-        MamOS_removeFromReadyQueue(G_kernelControlPanel.ptr2standbyTask);
-        
-        /* Move current task back to ready queue if it's not the idle task. */
-        if(G_kernelControlPanel.ptr2activeTask->id != MAMOS_IDLE_TASK_ID)
-        {
-            MamOS_addToReadyQueue(G_kernelControlPanel.ptr2activeTask);
-        }
-        
-        /* Trigger PendSV exception to perform context switch. */
-        SYSTEM_setExceptionPending(SYSTEM_PENDSV_EXCEPTION);
+    MamOS_taskControlBlockType* LOC_ptr2highestTask = MamOS_getHighestReadyTask();
+    uint8 LOC_switchFlag = FALSE;
+
+    /* Count the ticks consumed by the active task from its time slice. */
+    if(G_kernelControlPanel.sliceTicksCounter < MAMOS_TIME_SLICE_TICKS)
+    {
+        G_kernelControlPanel.sliceTicksCounter++;
+    }
+
+    /* Check if there is a higher priority [or an earlier deadline] task than the task that is going to run next. */
+    if(LOC_ptr2highestTask == NULL_PTR)
+    {
+        /* The ready queue is empty [the idle task is going to run next]. */
+    }
+
+    else if(MamOS_isTaskPreceding(LOC_ptr2highestTask, G_kernelControlPanel.ptr2standbyTask) == TRUE)
+    {
+        LOC_switchFlag = TRUE;
+    }
+
+    #if (MAMOS_TIME_SLICING == TRUE)
+    /* Rotate to the next equal priority task only after the active task consumes its whole time slice. */
+    else if((MamOS_isTaskPreceding(G_kernelControlPanel.ptr2standbyTask, LOC_ptr2highestTask) == FALSE) &&
+            (LOC_ptr2highestTask != G_kernelControlPanel.ptr2standbyTask) &&
+            (G_kernelControlPanel.sliceTicksCounter >= MAMOS_TIME_SLICE_TICKS))
+    {
+        LOC_switchFlag = TRUE;
+    }
+    #endif
+
+    if(LOC_switchFlag == TRUE)
+    {
+        MamOS_preemptStandbyTask(LOC_ptr2highestTask, TRUE);
     }
     #endif
+
+    MamOS_exitCritical();
 }
 
 /*=====================================================================================================================
@@ -80,35 +109,270 @@ void MamOS_schedulerTick(void)
  ====================================================================================================================*/
 void MamOS_forceTaskTransition(void)
 {
-    /* Fetch the higher priority task from the ready queue. */
-    G_kernelControlPanel.ptr2standbyTask = G_kernelControlPanel.readyQueue.ptr2headTask;
-    MamOS_removeFromReadyQueue(G_kernelControlPanel.ptr2standbyTask);
+    MamOS_enterCritical();
+
+    /* The active task is queued below, So it must not be linked in the ready queue by a pending switch. */
+    MamOS_revokeStandbyTask();
 
-    /* Move the current task to the blocked queue [if it's not waiting or idle]. */
-    if((G_kernelControlPanel.ptr2activeTask->state != MAMOS_WAITING_TASK) && (G_kernelControlPanel.ptr2activeTask->id != MAMOS_IDLE_TASK_ID))
+    /* Move the current task to the blocked queue [if it's not waiting, suspended or deleted, The idle task never
+     * delays, So it's moved back to the ready queue]. */
+    if((G_kernelControlPanel.ptr2activeTask->state != MAMOS_WAITING_TASK) && (G_kernelControlPanel.ptr2activeTask->state != MAMOS_SUSPENDED_TASK) &&
+       (G_kernelControlPanel.ptr2activeTask->state != MAMOS_DELETED_TASK))
     {
         MamOS_addToBlockedQueue(G_kernelControlPanel.ptr2activeTask);
     }
 
-    /* Trigger PendSV exception to perform context switch. */
-    SYSTEM_setExceptionPending(SYSTEM_PENDSV_EXCEPTION);
+    /* Fetch the higher priority task from the ready queue [the current task competes if its delay was zero]. */
+    G_kernelControlPanel.ptr2standbyTask = MamOS_getHighestReadyTask();
+    MamOS_removeFromReadyQueue(G_kernelControlPanel.ptr2standbyTask);
+    G_kernelControlPanel.ptr2standbyTask->state = MAMOS_ACTIVE_TASK;
+    G_kernelControlPanel.sliceTicksCounter = 0;                    /* The standby task starts a new time slice. */
+
+    /* Trigger PendSV exception to perform context switch [only if another task is selected]. */
+    if(G_kernelControlPanel.ptr2standbyTask != G_kernelControlPanel.ptr2activeTask)
+    {
+        SYSTEM_setExceptionPending(SYSTEM_PENDSV_EXCEPTION);
+    }
+
+    MamOS_exitCritical();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_revokeStandbyTask
+ * [Description]   : Cancels a context switch that is still pending when the active task enters the kernel [the
+ *                   tick or a FromISR wake-up preempted the SVC handler before it masked them], The standby task
+ *                   goes back to the ready queue and the active task leaves it, So the caller finds the active
+ *                   task linked in no queue and the standby task never gets lost.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns TRUE if a pending switch is cancelled, FALSE otherwise.
+ ====================================================================================================================*/
+uint8 MamOS_revokeStandbyTask(void)
+{
+    uint8 LOC_revokedFlag = FALSE;
+
+    MamOS_enterCritical();
+
+    /* A pending switch leaves the active task ready [the preempting task moved it back to the ready queue]. */
+    if((G_kernelControlPanel.ptr2standbyTask != G_kernelControlPanel.ptr2activeTask) && (G_kernelControlPanel.ptr2activeTask->state == MAMOS_READY_TASK))
+    {
+        MamOS_addToReadyQueue(G_kernelControlPanel.ptr2standbyTask);
+        MamOS_removeFromReadyQueue(G_kernelControlPanel.ptr2activeTask);
+        G_kernelControlPanel.ptr2activeTask->state = MAMOS_ACTIVE_TASK;
+        G_kernelControlPanel.ptr2standbyTask = G_kernelControlPanel.ptr2activeTask;
+        LOC_revokedFlag = TRUE;
+    }
+
+    MamOS_exitCritical();
+
+    return LOC_revokedFlag;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_forceTaskTransitionUntil
+ * [Description]   : Initiates an immediate context switch, Blocking the current task until its absolute release
+ *                   tick [the task is released immediately if its release tick has already passed].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_forceTaskTransitionUntil(void)
+{
+    sint32 LOC_remainingTicks = 0;
+
+    MamOS_enterCritical();
+
+    /* The delay is calculated here [not in the task] so a tick between the request and the switch is not lost. */
+    LOC_remainingTicks = (sint32)(G_kernelControlPanel.ptr2activeTask->releaseTick - (uint32)G_kernelControlPanel.ticksCounter);
+
+    G_kernelControlPanel.ptr2activeTask->delayTicks = (LOC_remainingTicks > 0) ? (uint32)LOC_remainingTicks : 0;
+    MamOS_forceTaskTransition();
+
+    MamOS_exitCritical();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_yieldFromISR
+ * [Description]   : Requests a context switch at the end of an interrupt if a FromISR call woke up a task that
+ *                   precedes the task going to run next, The requests of the nested interrupts are coalesced
+ *                   into a single PendSV that runs after the last interrupt exits.
+ * [Arguments]     : <a_higherPriorityTaskWoken> -> Indicates whether a higher priority task was woken or not
+ *                                                  [the result collected from the FromISR calls].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_yieldFromISR(uint8 a_higherPriorityTaskWoken)
+{
+    #if (MAMOS_PREEMPRIVE_SCHEDULER == TRUE)
+    if(a_higherPriorityTaskWoken == TRUE)
+    {
+        MamOS_selectPrecedingTask(TRUE);
+    }
+    #endif
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_yieldFromPendSV
+ * [Description]   : Selects a task woken inside the PendSV exception as the standby task if it precedes the task
+ *                   going to run next, The running PendSV switches to it, So PendSV is not triggered again.
+ * [Arguments]     : <a_higherPriorityTaskWoken> -> Indicates whether a higher priority task was woken or not.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_yieldFromPendSV(uint8 a_higherPriorityTaskWoken)
+{
+    #if (MAMOS_PREEMPRIVE_SCHEDULER == TRUE)
+    if(a_higherPriorityTaskWoken == TRUE)
+    {
+        MamOS_selectPrecedingTask(FALSE);
+    }
+    #endif
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_enterTicklessIdle
+ * [Description]   : Suppresses the system ticks until the nearest wake-up in the blocked queue, Sleeps until
+ *                   any interrupt, Then corrects the system tick counter with the elapsed ticks.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_enterTicklessIdle(void)
+{
+    #if (MAMOS_TICKLESS_IDLE == TRUE)
+    uint8 LOC_pendingStatus = FALSE;
+    uint32 LOC_idleTicks = 0;
+    uint32 LOC_elapsedTicks = 0;
+
+    /* Mask all the interrupts [not only up to the kernel priority ceiling, As WFI ignores the interrupts masked by
+     * BASEPRI], So the waking interrupt is only serviced after the tick counter is corrected. */
+    __asm__ volatile ("CPSID I");
+
+    /* Suppress the ticks only if the idle task is the only runnable task and no tick or switch is pending. */
+    SYSTEM_getExceptionPending(SYSTEM_SYSTICK_EXCEPTION, &LOC_pendingStatus);
+    if(LOC_pendingStatus == FALSE) SYSTEM_getExceptionPending(SYSTEM_PENDSV_EXCEPTION, &LOC_pendingStatus);
+
+    if((LOC_pendingStatus == FALSE) && (MamOS_getHighestReadyTask() == NULL_PTR))
+    {
+        /* Sleep until the nearest wake-up, or as long as the timer allows if there are no blocked tasks. */
+        LOC_idleTicks = (G_kernelControlPanel.blockEmptyFlag == TRUE) ? (uint32)-1 : MamOS_getNearestWakeUpDelay();
+
+        if(LOC_idleTicks >= MAMOS_TICKLESS_MIN_IDLE_TICKS)
+        {
+            TIMER_stretchPeriodicInterval(&LOC_idleTicks);
+
+            __asm__ volatile ("DSB");
+            __asm__ volatile ("WFI");            /* WFI: Wait For Interrupt - wakes up even if interrupts are masked. */
+            __asm__ volatile ("ISB");
+
+            TIMER_restorePeriodicInterval(&LOC_elapsedTicks);
+
+            /* Account for the suppressed ticks [the wake-up tick itself is left to the SysTick interrupt]. */
+            G_kernelControlPanel.ticksCounter += LOC_elapsedTicks;
+        }
+    }
+
+    __asm__ volatile ("CPSIE I");
+    #endif
 }
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_updateBlockedQueue
- * [Description]   : Updates the system tick counter and check if there are any expired delays.
+ * [Description]   : Checks if there are any expired delays in the blocked queue at the current system tick, The
+ *                   slots of the ticks suppressed since the last visited tick are visited too [each slot once].
  * [Arguments]     : The function Takes no arguments.
  * [return]        : The function returns void.
  ====================================================================================================================*/
 static void MamOS_updateBlockedQueue(void)
 {
-    G_kernelControlPanel.ticksCounter++;
+    uint32 LOC_visitedSlots = (uint32)G_kernelControlPanel.ticksCounter - G_kernelControlPanel.checkedTick;
+
+    /* The wake-up ticks are absolute, So visiting each slot once releases every expired delay however long the
+     * ticks were suppressed [only the slot of the current tick is visited if no tick was suppressed]. */
+    if(LOC_visitedSlots > MAMOS_TIMER_WHEEL_SIZE)
+    {
+        LOC_visitedSlots = MAMOS_TIMER_WHEEL_SIZE;
+    }
 
-    /* Move the tasks with expired delays to the ready queue. */
-    while(G_kernelControlPanel.ticksCounter == G_kernelControlPanel.blockedQueue.ptr2headTask->delayTicks)
+    for(uint32 LOC_slotIndex = 0; LOC_slotIndex < LOC_visitedSlots; LOC_slotIndex++)
     {
-        MamOS_taskControlBlockType* LOC_ptr2currentTask = G_kernelControlPanel.blockedQueue.ptr2headTask;
-        MamOS_removeFromBlockedQueue(LOC_ptr2currentTask);
-        MamOS_addToReadyQueue(LOC_ptr2currentTask);
+        MamOS_taskControlBlockType* LOC_ptr2currentTask = MamOS_getBlockedQueueSlot((uint32)G_kernelControlPanel.ticksCounter - LOC_slotIndex);
+
+        while(LOC_ptr2currentTask != NULL_PTR)
+        {
+            MamOS_taskControlBlockType* LOC_ptr2nextTask = LOC_ptr2currentTask->ptr2nextTask;
+
+            /* The slot may also hold tasks that wake up in a later round of the wheel. */
+            if(MAMOS_TICK_IS_REACHED(LOC_ptr2currentTask->delayTicks, G_kernelControlPanel.ticksCounter))
+            {
+                MamOS_removeFromBlockedQueue(LOC_ptr2currentTask);
+
+                /* A timed wait has expired, So the task stops waiting [its wait result stays FALSE]. */
+                if(LOC_ptr2currentTask->timedWaitFlag == TRUE)
+                {
+                    MamOS_removeFromWaitingQueue(LOC_ptr2currentTask);
+                    LOC_ptr2currentTask->timedWaitFlag = FALSE;
+
+                    if(LOC_ptr2currentTask->notificationState == MAMOS_NOTIFICATION_WAITING)
+                    {
+                        LOC_ptr2currentTask->notificationState = MAMOS_NOTIFICATION_NONE;
+                    }
+                }
+
+                MamOS_addToReadyQueue(LOC_ptr2currentTask);
+            }
+
+            LOC_ptr2currentTask = LOC_ptr2nextTask;
+        }
     }
 }
+
+#if (MAMOS_PREEMPRIVE_SCHEDULER == TRUE)
+/*=====================================================================================================================
+ * [Function Name] : MamOS_preemptStandbyTask
+ * [Description]   : Selects a ready task to run next instead of the standby task and triggers PendSV, The standby
+ *                   task is the active task unless a switch is already pending, So repeated requests before PendSV
+ *                   runs only replace the selected task and the pending PendSV is triggered once.
+ * [Arguments]     : <a_ptr2readyTask>  -> Pointer to the ready task to run next.
+ *                   <a_pendSwitchFlag> -> Indicates whether PendSV is triggered or not [not inside PendSV].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_preemptStandbyTask(MamOS_taskControlBlockType* a_ptr2readyTask, uint8 a_pendSwitchFlag)
+{
+    /* Fetch the required task from the ready queue. */
+    MamOS_removeFromReadyQueue(a_ptr2readyTask);
+
+    /* Move the preempted standby task back to ready queue [the idle task too]. */
+    MamOS_addToReadyQueue(G_kernelControlPanel.ptr2standbyTask);
+
+    G_kernelControlPanel.ptr2standbyTask = a_ptr2readyTask;
+    G_kernelControlPanel.ptr2standbyTask->state = MAMOS_ACTIVE_TASK;
+
+    /* The standby task starts a new time slice. */
+    G_kernelControlPanel.sliceTicksCounter = 0;
+
+    /* Trigger PendSV exception to perform context switch. */
+    if(a_pendSwitchFlag == TRUE)
+    {
+        SYSTEM_setExceptionPending(SYSTEM_PENDSV_EXCEPTION);
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_selectPrecedingTask
+ * [Description]   : Selects the highest priority ready task as the standby task if it precedes the task going to
+ *                   run next [after a task is woken].
+ * [Arguments]     : <a_pendSwitchFlag> -> Indicates whether PendSV is triggered or not [not inside PendSV].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_selectPrecedingTask(uint8 a_pendSwitchFlag)
+{
+    MamOS_taskControlBlockType* LOC_ptr2highestTask = NULL_PTR;
+
+    MamOS_enterCritical();
+
+    /* Re-check the ready queue, So a switch already selected by a nested interrupt or a tick is not repeated. */
+    LOC_ptr2highestTask = MamOS_getHighestReadyTask();
+    if((LOC_ptr2highestTask != NULL_PTR) && (MamOS_isTaskPreceding(LOC_ptr2highestTask, G_kernelControlPanel.ptr2standbyTask) == TRUE))
+    {
+        MamOS_preemptStandbyTask(LOC_ptr2highestTask, a_pendSwitchFlag);
+    }
+
+    MamOS_exitCritical();
+}
+#endif
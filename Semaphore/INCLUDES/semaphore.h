@@ -0,0 +1,59 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Semaphore
+File Name    : semaphore.h
+Date Created : Oct 17, 2026
+Description  : Interface file for the MamOS Semaphore module.
+=======================================================================================================================
+*/
+
+
+#ifndef MAMOS_SEMAPHORE_INCLUDES_SEMAPHORE_H_
+#define MAMOS_SEMAPHORE_INCLUDES_SEMAPHORE_H_
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createSemaphore
+ * [Description]   : Creates a new counting semaphore in the MamOS [a maximum count of one gives a binary semaphore].
+ * [Arguments]     : <a_initialCount>     -> Indicates to the initial number of available tokens.
+ *                   <a_maxCount>         -> Indicates to the maximum number of tokens [non-zero].
+ * [return]        : The function returns the handle to the created semaphore [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_semaphoreHandle MamOS_createSemaphore(uint32 a_initialCount, uint32 a_maxCount);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeSemaphore
+ * [Description]   : Takes a token from a specific semaphore, The task is blocked while no token is available until
+ *                   a token is given or the timeout expires.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if a token is taken, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_takeSemaphore(MamOS_semaphoreHandle a_ptr2semaphore, uint32 a_timeoutTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_giveSemaphore
+ * [Description]   : Gives a token to a specific semaphore, The token is handed over directly to the highest
+ *                   priority waiting task [if any] and the CPU is switched to it if it precedes the current task.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+uint8 MamOS_giveSemaphore(MamOS_semaphoreHandle a_ptr2semaphore);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_giveSemaphoreFromISR
+ * [Description]   : Gives a token to a specific semaphore from an interrupt, The context switch to the woken task
+ *                   is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+uint8 MamOS_giveSemaphoreFromISR(MamOS_semaphoreHandle a_ptr2semaphore, uint8* a_ptr2higherPriorityTaskWoken);
+
+#endif /* MAMOS_SEMAPHORE_INCLUDES_SEMAPHORE_H_ */
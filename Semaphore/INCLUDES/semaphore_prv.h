@@ -0,0 +1,56 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Semaphore
+File Name    : semaphore_prv.h
+Date Created : Oct 17, 2026
+Description  : Private file for the MamOS Semaphore module.
+=======================================================================================================================
+*/
+
+
+#ifndef MAMOS_SEMAPHORE_INCLUDES_SEMAPHORE_PRV_H_
+#define MAMOS_SEMAPHORE_INCLUDES_SEMAPHORE_PRV_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+typedef struct
+{
+    MamOS_semaphoreHandle ptr2semaphore;                    /* The required semaphore.                               */
+    uint32 timeoutTicks;                                    /* Maximum waiting time [in ticks].                      */
+}MamOS_semaphoreRequestType;
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_putSemaphoreToken
+ * [Description]   : Gives a token without blocking, Directly to the highest priority waiting task [if any] or to
+ *                   the semaphore count [called inside a critical section].
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ *                   <a_ptr2wokenTask>    -> Pointer to a variable to store the woken task [if any].
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+static uint8 MamOS_putSemaphoreToken(MamOS_semaphoreHandle a_ptr2semaphore, MamOS_taskControlBlockType** a_ptr2wokenTask);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeSemaphoreCall
+ * [Description]   : Handles taking a token from a specific semaphore [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the take request.
+ * [return]        : The function returns TRUE if a token is taken, FALSE if no token is available, Or pending if
+ *                   the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_takeSemaphoreCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_giveSemaphoreCall
+ * [Description]   : Handles giving a token to a specific semaphore [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the required semaphore.
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+static uint32 MamOS_giveSemaphoreCall(void* a_ptr2argument);
+
+#endif /* MAMOS_SEMAPHORE_INCLUDES_SEMAPHORE_PRV_H_ */
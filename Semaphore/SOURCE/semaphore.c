@@ -0,0 +1,235 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Semaphore
+File Name    : semaphore.c
+Date Created : Oct 17, 2026
+Description  : Source file for the MamOS Semaphore module.
+=======================================================================================================================
+*/
+
+
+/*=====================================================================================================================
+ * [Details]     : This module hosts the counting and binary semaphores of the MamOS, They signal events between
+ *                 tasks [and from interrupts to tasks] without ownership. The tasks that wait for a token wait in a
+ *                 priority ordered waiting queue with an optional timeout, and a given token is handed over
+ *                 directly to the highest priority waiting task.
+ ====================================================================================================================*/
+
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+#include "../../Others/std_types.h"
+#include "../../Others/kernel_defs.h"
+#include "../../Queue/INCLUDES/queue.h"
+#include "../../Scheduler/INCLUDES/scheduler.h"
+#include "../../Core/INCLUDES/core.h"
+#include "../INCLUDES/semaphore_prv.h"
+#include "../INCLUDES/semaphore.h"
+
+/*=====================================================================================================================
+                                           < Global Variables >
+=====================================================================================================================*/
+
+/* Array of semaphores that available in the system. */
+volatile MamOS_semaphoreType G_semaphoreHeap[MAMOS_MAX_NUM_OF_SEMAPHORES] = {0};
+
+/* Extern the Kernel Control Panel. */
+extern MamOS_kernelControlPanelType G_kernelControlPanel;
+
+/*=====================================================================================================================
+                                          < Functions Definitions >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createSemaphore
+ * [Description]   : Creates a new counting semaphore in the MamOS [a maximum count of one gives a binary semaphore].
+ * [Arguments]     : <a_initialCount>     -> Indicates to the initial number of available tokens.
+ *                   <a_maxCount>         -> Indicates to the maximum number of tokens [non-zero].
+ * [return]        : The function returns the handle to the created semaphore [or Null Pointer if creation fails].
+ ====================================================================================================================*/
+MamOS_semaphoreHandle MamOS_createSemaphore(uint32 a_initialCount, uint32 a_maxCount)
+{
+    MamOS_semaphoreHandle LOC_createdSemaphoreHandle = NULL_PTR;
+
+    if(G_kernelControlPanel.semaphoreCounter >= MAMOS_MAX_NUM_OF_SEMAPHORES)
+    {
+        /* Invalid Operation. */
+    }
+
+    else if((a_maxCount == 0) || (a_initialCount > a_maxCount))
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        /* Get the handle of the created semaphore and increment the semaphore counter. */
+        LOC_createdSemaphoreHandle = &G_semaphoreHeap[G_kernelControlPanel.semaphoreCounter];
+        G_kernelControlPanel.semaphoreCounter++;
+
+        /* Initialize the new semaphore. */
+        LOC_createdSemaphoreHandle->count = a_initialCount;
+        LOC_createdSemaphoreHandle->maxCount = a_maxCount;
+        LOC_createdSemaphoreHandle->waitingQueue.queueSize = 0;
+        LOC_createdSemaphoreHandle->waitingQueue.ptr2headTask = NULL_PTR;
+        LOC_createdSemaphoreHandle->waitingQueue.ptr2rearTask = NULL_PTR;
+    }
+
+    return LOC_createdSemaphoreHandle;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeSemaphore
+ * [Description]   : Takes a token from a specific semaphore, The task is blocked while no token is available until
+ *                   a token is given or the timeout expires.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ *                   <a_timeoutTicks>     -> Indicates to the maximum waiting time [in ticks], Zero to never wait,
+ *                                           Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if a token is taken, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_takeSemaphore(MamOS_semaphoreHandle a_ptr2semaphore, uint32 a_timeoutTicks)
+{
+    uint32 LOC_result = FALSE;
+    MamOS_semaphoreRequestType LOC_request = {a_ptr2semaphore, a_timeoutTicks};
+
+    LOC_result = MamOS_kernelCall(MamOS_takeSemaphoreCall, &LOC_request);
+
+    /* The task was blocked, So the result is known only after a token is handed over or the timeout expires. */
+    if(LOC_result == MAMOS_WAIT_RESULT_PENDING)
+    {
+        LOC_result = G_kernelControlPanel.ptr2activeTask->waitResult;
+    }
+
+    return (uint8)LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_giveSemaphore
+ * [Description]   : Gives a token to a specific semaphore, The token is handed over directly to the highest
+ *                   priority waiting task [if any] and the CPU is switched to it if it precedes the current task.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+uint8 MamOS_giveSemaphore(MamOS_semaphoreHandle a_ptr2semaphore)
+{
+    return (uint8)MamOS_kernelCall(MamOS_giveSemaphoreCall, a_ptr2semaphore);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_giveSemaphoreFromISR
+ * [Description]   : Gives a token to a specific semaphore from an interrupt, The context switch to the woken task
+ *                   is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+uint8 MamOS_giveSemaphoreFromISR(MamOS_semaphoreHandle a_ptr2semaphore, uint8* a_ptr2higherPriorityTaskWoken)
+{
+    uint8 LOC_result = FALSE;
+    MamOS_taskControlBlockType* LOC_ptr2wokenTask = NULL_PTR;
+
+    MamOS_enterCritical();
+
+    LOC_result = MamOS_putSemaphoreToken(a_ptr2semaphore, &LOC_ptr2wokenTask);
+
+    if((LOC_ptr2wokenTask != NULL_PTR) && (a_ptr2higherPriorityTaskWoken != NULL_PTR))
+    {
+        if(MamOS_isTaskPreceding(LOC_ptr2wokenTask, G_kernelControlPanel.ptr2standbyTask) == TRUE)
+        {
+            *a_ptr2higherPriorityTaskWoken = TRUE;
+        }
+    }
+
+    MamOS_exitCritical();
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_putSemaphoreToken
+ * [Description]   : Gives a token without blocking, Directly to the highest priority waiting task [if any] or to
+ *                   the semaphore count [called inside a critical section].
+ * [Arguments]     : <a_ptr2semaphore>    -> Pointer to the required semaphore.
+ *                   <a_ptr2wokenTask>    -> Pointer to a variable to store the woken task [if any].
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+static uint8 MamOS_putSemaphoreToken(MamOS_semaphoreHandle a_ptr2semaphore, MamOS_taskControlBlockType** a_ptr2wokenTask)
+{
+    uint8 LOC_result = TRUE;
+    MamOS_taskControlBlockType* LOC_ptr2waitingTask = a_ptr2semaphore->waitingQueue.ptr2headTask;
+
+    /* Tasks wait only while the count is zero, So the token is handed over without touching the count. */
+    if(LOC_ptr2waitingTask != NULL_PTR)
+    {
+        MamOS_wakeFromWaitingQueue(LOC_ptr2waitingTask);
+        *a_ptr2wokenTask = LOC_ptr2waitingTask;
+    }
+
+    else if(a_ptr2semaphore->count < a_ptr2semaphore->maxCount)
+    {
+        a_ptr2semaphore->count++;
+    }
+
+    else
+    {
+        LOC_result = FALSE;
+    }
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_takeSemaphoreCall
+ * [Description]   : Handles taking a token from a specific semaphore [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the take request.
+ * [return]        : The function returns TRUE if a token is taken, FALSE if no token is available, Or pending if
+ *                   the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_takeSemaphoreCall(void* a_ptr2argument)
+{
+    uint32 LOC_result = TRUE;
+    MamOS_semaphoreRequestType* LOC_ptr2request = a_ptr2argument;
+
+    if(LOC_ptr2request->ptr2semaphore->count != 0)
+    {
+        LOC_ptr2request->ptr2semaphore->count--;
+    }
+
+    else if(LOC_ptr2request->timeoutTicks == 0)
+    {
+        LOC_result = FALSE;
+    }
+
+    else
+    {
+        MamOS_addToWaitingQueue(&LOC_ptr2request->ptr2semaphore->waitingQueue, G_kernelControlPanel.ptr2activeTask, LOC_ptr2request->timeoutTicks);
+        MamOS_forceTaskTransition();
+        LOC_result = MAMOS_WAIT_RESULT_PENDING;
+    }
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_giveSemaphoreCall
+ * [Description]   : Handles giving a token to a specific semaphore [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument>     -> Pointer to the required semaphore.
+ * [return]        : The function returns TRUE if the token is given, FALSE if the semaphore is already full.
+ ====================================================================================================================*/
+static uint32 MamOS_giveSemaphoreCall(void* a_ptr2argument)
+{
+    uint8 LOC_result = FALSE;
+    MamOS_taskControlBlockType* LOC_ptr2wokenTask = NULL_PTR;
+
+    LOC_result = MamOS_putSemaphoreToken((MamOS_semaphoreHandle)a_ptr2argument, &LOC_ptr2wokenTask);
+
+    if(LOC_ptr2wokenTask != NULL_PTR)
+    {
+        MamOS_yieldFromISR(MamOS_isTaskPreceding(LOC_ptr2wokenTask, G_kernelControlPanel.ptr2standbyTask));
+    }
+
+    return LOC_result;
+}
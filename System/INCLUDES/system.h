@@ -27,6 +27,7 @@ typedef enum
 {
     SYSTEM_PENDSV_EXCEPTION,            /* PendSV Exception.               */
     SYSTEM_SYSTICK_EXCEPTION,           /* SysTick Exception.              */
+    SYSTEM_SVCALL_EXCEPTION,            /* SVCall Exception.               */
 }SYSTEM_exceptionType;
 
 /*=====================================================================================================================
@@ -63,6 +64,17 @@ SYSTEM_errorStatusType SYSTEM_getExceptionPriority(SYSTEM_exceptionType a_except
  ====================================================================================================================*/
 SYSTEM_errorStatusType SYSTEM_setExceptionPending(SYSTEM_exceptionType a_exceptionNumber);
 
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_getExceptionPending
+ * [Description]   : Get the pending status for a specific Exception.
+ * [Arguments]     : <a_exceptionNumber>      -> Indicates to the required Exception.
+ *                   <a_ptr2pendingStatus>    -> Pointer to a variable to store the pending status [TRUE or FALSE].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Exception Number Error.
+ ====================================================================================================================*/
+SYSTEM_errorStatusType SYSTEM_getExceptionPending(SYSTEM_exceptionType a_exceptionNumber, uint8* a_ptr2pendingStatus);
+
 /*=====================================================================================================================
  * [Function Name] : SYSTEM_clearExceptionPending
  * [Description]   : Clear the pending status for a specific Exception.
@@ -72,4 +84,55 @@ SYSTEM_errorStatusType SYSTEM_setExceptionPending(SYSTEM_exceptionType a_excepti
  ====================================================================================================================*/
 SYSTEM_errorStatusType SYSTEM_clearExceptionPending(SYSTEM_exceptionType a_exceptionNumber);
 
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_setFpuAccess
+ * [Description]   : Enable or disable the access to the FPU, Any FPU instruction traps while it's disabled.
+ * [Arguments]     : <a_accessState>          -> Indicates to the required access state [TRUE or FALSE].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void SYSTEM_setFpuAccess(uint8 a_accessState);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_enableCycleCounter
+ * [Description]   : Enable the DWT cycle counter, So the CPU cycles can be counted for profiling.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void SYSTEM_enableCycleCounter(void);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_getCycleCount
+ * [Description]   : Get the current value of the DWT cycle counter [wraps around every 2^32 cycles].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the current CPU cycle count.
+ ====================================================================================================================*/
+uint32 SYSTEM_getCycleCount(void);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_enableMemoryProtection
+ * [Description]   : Enable the MPU with background regions that grant the unprivileged code the code, the SRAM and
+ *                   the peripherals, Then enable the MemManage fault, So any access denied by the task regions above
+ *                   them faults immediately [the privileged code keeps the default memory map].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void SYSTEM_enableMemoryProtection(void);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_setMemoryRegion
+ * [Description]   : Set the base address and the attributes of a specific MPU region.
+ * [Arguments]     : <a_regionBaseAddress>    -> Indicates to the region RBAR value [it holds the region number].
+ *                   <a_regionAttributes>     -> Indicates to the region RASR value [size, access and enable].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void SYSTEM_setMemoryRegion(uint32 a_regionBaseAddress, uint32 a_regionAttributes);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_getMemoryFaultAddress
+ * [Description]   : Get the address that caused the last MemManage fault, Then clear the MemManage fault status.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the faulting address [or zero if the fault has no valid address].
+ ====================================================================================================================*/
+uint32 SYSTEM_getMemoryFaultAddress(void);
+
 #endif /* MAMOS_SYSTEM_INCLUDES_SYSTEM_H_ */
@@ -35,8 +35,21 @@ typedef struct
     volatile uint32 SHPR3;     /* System Handler Priority Register 3.               */
     volatile uint32 SHCRS;     /* System Handler Control and State Register.        */
     volatile uint32 CFSR;      /* Configurable Fault Status Register.               */
+    volatile uint32 HFSR;      /* HardFault Status Register.                        */
+    volatile uint32 DFSR;      /* Debug Fault Status Register.                      */
+    volatile uint32 MMFAR;     /* MemManage Fault Address Register.                 */
+    volatile uint32 BFAR;      /* BusFault Address Register.                        */
 }SCB_registersType;
 
+typedef struct
+{
+    volatile uint32 TYPE;      /* MPU Type Register.                                */
+    volatile uint32 CTRL;      /* MPU Control Register.                             */
+    volatile uint32 RNR;       /* MPU Region Number Register.                       */
+    volatile uint32 RBAR;      /* MPU Region Base Address Register.                 */
+    volatile uint32 RASR;      /* MPU Region Attribute and Size Register.           */
+}MPU_registersType;
+
 /*=====================================================================================================================
                                 < Peripheral Registers and Bits Definitions >
 =====================================================================================================================*/
@@ -44,6 +57,18 @@ typedef struct
 /* The System Control Block (SCB) peripheral registers base addresss. */
 #define SCB                    ((volatile SCB_registersType*)0XE000ED00)
 
+/* The Memory Protection Unit (MPU) peripheral registers base address. */
+#define MPU                    ((volatile MPU_registersType*)0XE000ED90)
+
+/* The Coprocessor Access Control Register (CPACR) address [it's not contiguous with the SCB registers above]. */
+#define SCB_CPACR              (*((volatile uint32*)0XE000ED88))
+
+/* The Debug Exception and Monitor Control Register (DEMCR) and the Data Watchpoint and Trace (DWT) registers. */
+#define SCB_DEMCR              (*((volatile uint32*)0XE000EDFC))
+#define DWT_CTRL               (*((volatile uint32*)0XE0001000))
+#define DWT_CYCCNT             (*((volatile uint32*)0XE0001004))
+
+#define SCB_SHPR2_SVCALL_FIELD                      (24UL)     /* SVCall Priority field base bit number.   */
 #define SCB_SHPR3_PENDSV_FIELD                      (16UL)     /* PendSV Priority field base bit number.   */
 #define SCB_SHPR3_SYSTICK_FIELD                     (24UL)     /* SysTick Priority field base bit number.  */
 
@@ -52,4 +77,22 @@ typedef struct
 #define SCB_ICSR_PENDSVCLR_BIT                      (27UL)     /* PendSV Clear Pending bit number.         */
 #define SCB_ICSR_PENDSVSET_BIT                      (28UL)     /* PendSV Set Pending bit number.           */
 
+#define SCB_CPACR_FPU_FIELD                         (20UL)     /* CP10 and CP11 access fields base bit.    */
+#define SCB_CPACR_FPU_FULL_ACCESS                   (0X0FUL)   /* Full access value for CP10 and CP11.     */
+
+#define SCB_DEMCR_TRCENA_BIT                        (24UL)     /* Trace [DWT] Enable bit number.           */
+#define DWT_CTRL_CYCCNTENA_BIT                      (0UL)      /* Cycle Counter Enable bit number.         */
+
+#define SCB_SHCSR_MEMFAULTENA_BIT                   (16UL)     /* MemManage Fault Enable bit number.       */
+#define SCB_CFSR_MMARVALID_BIT                      (7UL)      /* MMFAR holds a valid address bit number.  */
+#define SCB_CFSR_MMFSR_MASK                         (0XFFUL)   /* MemManage Fault Status bits mask.        */
+#define MPU_CTRL_ENABLE_BIT                         (0UL)      /* MPU Enable bit number.                   */
+#define MPU_CTRL_PRIVDEFENA_BIT                     (2UL)      /* Privileged Default Memory Map bit.       */
+
+/* Background regions that grant the unprivileged tasks the code, the SRAM and the peripherals [regions 0 and 1]. */
+#define MPU_MEMORY_REGION_RBAR                      (0X00000010UL)  /* Region 0 at 0X00000000 [code, RAM]. */
+#define MPU_MEMORY_REGION_RASR                      (0X0302003BUL)  /* 1 GB, Full access, Normal memory.   */
+#define MPU_DEVICE_REGION_RBAR                      (0X40000011UL)  /* Region 1 at 0X40000000 [devices].   */
+#define MPU_DEVICE_REGION_RASR                      (0X13050039UL)  /* 512 MB, Full access, Device, XN.    */
+
 #endif /* MAMOS_SYSTEM_INCLUDES_SYSTEM_PRV_H_ */
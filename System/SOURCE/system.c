@@ -39,7 +39,7 @@ SYSTEM_errorStatusType SYSTEM_setExceptionPriority(SYSTEM_exceptionType a_except
 {
     SYSTEM_errorStatusType LOC_errorStatus = SYSTEM_NO_ERRORS;
 
-    if((a_exceptionNumber != SYSTEM_PENDSV_EXCEPTION) && (a_exceptionNumber != SYSTEM_SYSTICK_EXCEPTION))
+    if((a_exceptionNumber != SYSTEM_PENDSV_EXCEPTION) && (a_exceptionNumber != SYSTEM_SYSTICK_EXCEPTION) && (a_exceptionNumber != SYSTEM_SVCALL_EXCEPTION))
     {
         LOC_errorStatus = SYSTEM_EXC_NUM_ERROR;
     }
@@ -49,6 +49,7 @@ SYSTEM_errorStatusType SYSTEM_setExceptionPriority(SYSTEM_exceptionType a_except
         /* Set the priority value for the required exception. */
         if(a_exceptionNumber == SYSTEM_PENDSV_EXCEPTION) SCB->SHPR3 |= (a_priority << SCB_SHPR3_PENDSV_FIELD);
         else if(a_exceptionNumber == SYSTEM_SYSTICK_EXCEPTION) SCB->SHPR3 |= (a_priority << SCB_SHPR3_SYSTICK_FIELD);
+        else if(a_exceptionNumber == SYSTEM_SVCALL_EXCEPTION) SCB->SHPR2 |= (a_priority << SCB_SHPR2_SVCALL_FIELD);
     }
 
     return LOC_errorStatus;
@@ -72,7 +73,7 @@ SYSTEM_errorStatusType SYSTEM_getExceptionPriority(SYSTEM_exceptionType a_except
         LOC_errorStatus = SYSTEM_NULL_PTR_ERROR;
     }
 
-    else if((a_exceptionNumber != SYSTEM_PENDSV_EXCEPTION) && (a_exceptionNumber != SYSTEM_SYSTICK_EXCEPTION))
+    else if((a_exceptionNumber != SYSTEM_PENDSV_EXCEPTION) && (a_exceptionNumber != SYSTEM_SYSTICK_EXCEPTION) && (a_exceptionNumber != SYSTEM_SVCALL_EXCEPTION))
     {
         LOC_errorStatus = SYSTEM_EXC_NUM_ERROR;
     }
@@ -82,6 +83,7 @@ SYSTEM_errorStatusType SYSTEM_getExceptionPriority(SYSTEM_exceptionType a_except
         /* Get the priority value for the required exception. */
         if(a_exceptionNumber == SYSTEM_PENDSV_EXCEPTION) *a_ptr2priority = ((SCB->SHPR3 >> SCB_SHPR3_PENDSV_FIELD) & 0X000000FF);
         else if(a_exceptionNumber == SYSTEM_SYSTICK_EXCEPTION) *a_ptr2priority = ((SCB->SHPR3 >> SCB_SHPR3_SYSTICK_FIELD) & 0X000000FF);
+        else if(a_exceptionNumber == SYSTEM_SVCALL_EXCEPTION) *a_ptr2priority = ((SCB->SHPR2 >> SCB_SHPR2_SVCALL_FIELD) & 0X000000FF);
     }
 
     return LOC_errorStatus;
@@ -113,6 +115,39 @@ SYSTEM_errorStatusType SYSTEM_setExceptionPending(SYSTEM_exceptionType a_excepti
     return LOC_errorStatus;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_getExceptionPending
+ * [Description]   : Get the pending status for a specific Exception.
+ * [Arguments]     : <a_exceptionNumber>      -> Indicates to the required Exception.
+ *                   <a_ptr2pendingStatus>    -> Pointer to a variable to store the pending status [TRUE or FALSE].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Exception Number Error.
+ ====================================================================================================================*/
+SYSTEM_errorStatusType SYSTEM_getExceptionPending(SYSTEM_exceptionType a_exceptionNumber, uint8* a_ptr2pendingStatus)
+{
+    SYSTEM_errorStatusType LOC_errorStatus = SYSTEM_NO_ERRORS;
+
+    if(a_ptr2pendingStatus == NULL_PTR)
+    {
+        LOC_errorStatus = SYSTEM_NULL_PTR_ERROR;
+    }
+
+    else if((a_exceptionNumber != SYSTEM_PENDSV_EXCEPTION) && (a_exceptionNumber != SYSTEM_SYSTICK_EXCEPTION))
+    {
+        LOC_errorStatus = SYSTEM_EXC_NUM_ERROR;
+    }
+
+    else
+    {
+        /* Get the pending status for the required exception. */
+        if(a_exceptionNumber == SYSTEM_PENDSV_EXCEPTION) *a_ptr2pendingStatus = GET_BIT(SCB->ICSR, SCB_ICSR_PENDSVSET_BIT);
+        else if(a_exceptionNumber == SYSTEM_SYSTICK_EXCEPTION) *a_ptr2pendingStatus = GET_BIT(SCB->ICSR, SCB_ICSR_PENDSTSET_BIT);
+    }
+
+    return LOC_errorStatus;
+}
+
 /*=====================================================================================================================
  * [Function Name] : SYSTEM_clearExceptionPending
  * [Description]   : Clear the pending status for a specific Exception.
@@ -138,3 +173,109 @@ SYSTEM_errorStatusType SYSTEM_clearExceptionPending(SYSTEM_exceptionType a_excep
 
     return LOC_errorStatus;
 }
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_setFpuAccess
+ * [Description]   : Enable or disable the access to the FPU, Any FPU instruction traps while it's disabled.
+ * [Arguments]     : <a_accessState>          -> Indicates to the required access state [TRUE or FALSE].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void SYSTEM_setFpuAccess(uint8 a_accessState)
+{
+    if(a_accessState == TRUE)
+    {
+        SCB_CPACR |= (SCB_CPACR_FPU_FULL_ACCESS << SCB_CPACR_FPU_FIELD);       /* Grant full access to the FPU. */
+    }
+
+    else
+    {
+        SCB_CPACR &= ~(SCB_CPACR_FPU_FULL_ACCESS << SCB_CPACR_FPU_FIELD);      /* Deny any access to the FPU.   */
+    }
+
+    /* Make sure the new access state is used by the following instructions. */
+    __asm__ volatile ("DSB");
+    __asm__ volatile ("ISB");
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_enableCycleCounter
+ * [Description]   : Enable the DWT cycle counter, So the CPU cycles can be counted for profiling.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void SYSTEM_enableCycleCounter(void)
+{
+    SET_BIT(SCB_DEMCR, SCB_DEMCR_TRCENA_BIT);                                    /* Enable the DWT unit.         */
+    DWT_CYCCNT = 0;                                                              /* Reset the cycle counter.     */
+    SET_BIT(DWT_CTRL, DWT_CTRL_CYCCNTENA_BIT);                                   /* Start the cycle counter.     */
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_getCycleCount
+ * [Description]   : Get the current value of the DWT cycle counter [wraps around every 2^32 cycles].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the current CPU cycle count.
+ ====================================================================================================================*/
+uint32 SYSTEM_getCycleCount(void)
+{
+    return DWT_CYCCNT;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_enableMemoryProtection
+ * [Description]   : Enable the MPU with background regions that grant the unprivileged code the code, the SRAM and
+ *                   the peripherals, Then enable the MemManage fault, So any access denied by the task regions above
+ *                   them faults immediately [the privileged code keeps the default memory map].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void SYSTEM_enableMemoryProtection(void)
+{
+    /* Program the background regions before enabling the MPU. */
+    SYSTEM_setMemoryRegion(MPU_MEMORY_REGION_RBAR, MPU_MEMORY_REGION_RASR);
+    SYSTEM_setMemoryRegion(MPU_DEVICE_REGION_RBAR, MPU_DEVICE_REGION_RASR);
+
+    SET_BIT(SCB->SHCRS, SCB_SHCSR_MEMFAULTENA_BIT);                              /* Enable the MemManage fault.  */
+    MPU->CTRL = (1UL << MPU_CTRL_ENABLE_BIT) | (1UL << MPU_CTRL_PRIVDEFENA_BIT); /* Enable the MPU.              */
+
+    /* Make sure the regions are used by the following instructions. */
+    __asm__ volatile ("DSB");
+    __asm__ volatile ("ISB");
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_setMemoryRegion
+ * [Description]   : Set the base address and the attributes of a specific MPU region.
+ * [Arguments]     : <a_regionBaseAddress>    -> Indicates to the region RBAR value [it holds the region number].
+ *                   <a_regionAttributes>     -> Indicates to the region RASR value [size, access and enable].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void SYSTEM_setMemoryRegion(uint32 a_regionBaseAddress, uint32 a_regionAttributes)
+{
+    MPU->RBAR = a_regionBaseAddress;                            /* The valid RBAR selects the region number too. */
+    MPU->RASR = a_regionAttributes;
+
+    /* Make sure the new region is used by the following instructions. */
+    __asm__ volatile ("DSB");
+    __asm__ volatile ("ISB");
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTEM_getMemoryFaultAddress
+ * [Description]   : Get the address that caused the last MemManage fault, Then clear the MemManage fault status.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns the faulting address [or zero if the fault has no valid address].
+ ====================================================================================================================*/
+uint32 SYSTEM_getMemoryFaultAddress(void)
+{
+    uint32 LOC_faultAddress = 0;
+
+    if(GET_BIT(SCB->CFSR, SCB_CFSR_MMARVALID_BIT))
+    {
+        LOC_faultAddress = SCB->MMFAR;
+    }
+
+    SCB->CFSR = SCB_CFSR_MMFSR_MASK;                            /* Clear the MemManage fault status [write one]. */
+
+    return LOC_faultAddress;
+}
@@ -23,9 +23,39 @@ Description  : Interface file for the MamOS Task module.
  *                   <a_taskStackSize>      -> Indicates to the task stack size [in words].
  *                   <a_priority>           -> Indicates to the task priority [0 ~ 255].
  *                   <a_periodicity>        -> Indicates to the periodic task periodicity [in system ticks].
+ *                   <a_fpuUsage>           -> Indicates whether the task uses the FPU or not, The FPU context is
+ *                                             added to the stack size of the FPU tasks only.
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_createTask(void (*a_ptr2taskEntryPoint)(void), uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity);
+void MamOS_createTask(void (*a_ptr2taskEntryPoint)(void), uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity, uint8 a_fpuUsage);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createStaticTask
+ * [Description]   : Creates a new task on a stack supplied by the user instead of the kernel stack pool, sets up
+ *                   its stack, and adds it to the ready queue.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Pointer to the task entry point.
+ *                   <a_ptr2taskStack>      -> Pointer to the task stack buffer [8-byte aligned, Or 32-byte aligned
+ *                                             if the MPU stack guards are enabled].
+ *                   <a_taskStackSize>      -> Indicates to the task stack buffer size [in words], It includes the
+ *                                             FPU context of the FPU tasks [and the stack guard words at the
+ *                                             bottom of the buffer if the MPU stack guards are enabled].
+ *                   <a_priority>           -> Indicates to the task priority [0 ~ 255].
+ *                   <a_periodicity>        -> Indicates to the periodic task periodicity [in system ticks].
+ *                   <a_fpuUsage>           -> Indicates whether the task uses the FPU or not.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_createStaticTask(void (*a_ptr2taskEntryPoint)(void), uint32* a_ptr2taskStack, uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity, uint8 a_fpuUsage);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_deleteTask
+ * [Description]   : Deletes a specific task, It's removed from the queue that holds it, Its mutexes are handed
+ *                   over to their waiting tasks, Its stack returns to the kernel stack pool [if it's taken from it],
+ *                   And its task control block is reused by the next created task. A task that deletes itself is
+ *                   switched out at once and never returns [the idle task can't be deleted].
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_deleteTask(MamOS_taskHandle a_ptr2task);
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_suspendTask
@@ -43,13 +73,36 @@ void MamOS_suspendTask(void (*a_ptr2taskEntryPoint)(void));
  ====================================================================================================================*/
 void MamOS_resumeTask(void (*a_ptr2taskEntryPoint)(void));
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_resumeTaskFromISR
+ * [Description]   : Resumes a suspended task from an interrupt context, The context switch is left to
+ *                   MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2taskEntryPoint>        -> Indicates to the required task to be resumed.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the resumed
+ *                                                    task precedes the task going to run next [never cleared].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_resumeTaskFromISR(void (*a_ptr2taskEntryPoint)(void), uint8* a_ptr2higherPriorityTaskWoken);
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_taskDelay
  * [Description]   : Delays the current task for a specified number of ticks.
- * [Arguments]     : <a_delayTicks> -> Indicates to the number of ticks to delay the task.
+ * [Arguments]     : <a_delayTicks> -> Indicates to the number of ticks to delay the task [up to 2^31 - 1].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_taskDelay(uint32 a_delayTicks);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_taskDelayUntil
+ * [Description]   : Delays the current task until a specific number of ticks after its last wake-up tick,
+ *                   So a periodic task is released at a fixed rate regardless of its execution time.
+ * [Arguments]     : <a_ptr2lastWakeTick> -> Pointer to the last wake-up tick held by the task [initialized with
+ *                                           MamOS_getTickCount, So it's 64-bit too], It's updated with the next
+ *                                           wake-up tick.
+ *                   <a_periodTicks>      -> Indicates to the number of ticks between the wake-up ticks.
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_taskDelay(uint16 a_delayTicks);
+void MamOS_taskDelayUntil(uint64* a_ptr2lastWakeTick, uint32 a_periodTicks);
 
 /*=====================================================================================================================
  * [Function Name] : MamOS_taskYield
@@ -59,4 +112,91 @@ void MamOS_taskDelay(uint16 a_delayTicks);
  ====================================================================================================================*/
 void MamOS_taskYield(void);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_taskYieldToPeers
+ * [Description]   : Gives up the rest of the current time slice to the ready tasks with the same priority,
+ *                   The current task stays ready and runs again after its peers [or immediately if none].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_taskYieldToPeers(void);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTaskHandle
+ * [Description]   : Gets the handle of a specific task, So it can be notified directly without searching for it.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Indicates to the required task.
+ * [return]        : The function returns the handle to the required task [or Null Pointer if it's not found].
+ ====================================================================================================================*/
+MamOS_taskHandle MamOS_getTaskHandle(void (*a_ptr2taskEntryPoint)(void));
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTaskStackHighWater
+ * [Description]   : Gets the minimum number of free words that a specific task ever left in its stack, The whole
+ *                   stack is painted at creation, So the words at the bottom of the stack that still hold the paint
+ *                   were never used.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ * [return]        : The function returns the minimum remaining free words of the task stack.
+ ====================================================================================================================*/
+uint32 MamOS_getTaskStackHighWater(MamOS_taskHandle a_ptr2task);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setTaskMemoryRegion
+ * [Description]   : Sets one of the MPU data regions of a specific task, So the task access to the region is
+ *                   limited [read only or no access] while the task is running, Any denied access faults at once.
+ *                   The regions take effect only if MAMOS_MPU_PROTECTION is enabled.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ *                   <a_regionIndex>        -> Indicates to the data region index [0 ~ 1].
+ *                   <a_ptr2regionBase>     -> Pointer to the region base [aligned to the region size].
+ *                   <a_regionSize>         -> Indicates to the region size [in bytes, a power of 2 from 32 bytes],
+ *                                             Or zero to disable the data region.
+ *                   <a_access>             -> Indicates to the task access: - MAMOS_REGION_NO_ACCESS.
+ *                                                                          - MAMOS_REGION_READ_ONLY.
+ *                                                                          - MAMOS_REGION_READ_WRITE.
+ * [return]        : The function returns TRUE if the region is set, FALSE if the region is invalid.
+ ====================================================================================================================*/
+uint8 MamOS_setTaskMemoryRegion(MamOS_taskHandle a_ptr2task, uint8 a_regionIndex, void* a_ptr2regionBase, uint32 a_regionSize, uint8 a_access);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_notifyTask
+ * [Description]   : Sends a direct notification to a specific task, Then wakes it up if it's waiting for a
+ *                   notification and switches to it if it precedes the current task [no queue is searched].
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the task to be notified.
+ *                   <a_value>              -> Indicates to the bits to be set or the value to be written.
+ *                   <a_action>             -> Indicates to the notify action: - MAMOS_NOTIFY_SET_BITS.
+ *                                                                            - MAMOS_NOTIFY_INCREMENT.
+ *                                                                            - MAMOS_NOTIFY_OVERWRITE.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_notifyTask(MamOS_taskHandle a_ptr2task, uint32 a_value, uint8 a_action);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_notifyTaskFromISR
+ * [Description]   : Sends a direct notification to a specific task from an interrupt, The context switch to the
+ *                   woken task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the task to be notified.
+ *                   <a_value>              -> Indicates to the bits to be set or the value to be written.
+ *                   <a_action>             -> Indicates to the notify action [set bits, increment, or overwrite].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_notifyTaskFromISR(MamOS_taskHandle a_ptr2task, uint32 a_value, uint8 a_action, uint8* a_ptr2higherPriorityTaskWoken);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitForNotification
+ * [Description]   : Waits for a direct notification to the current task, The task is blocked until it's notified
+ *                   or the timeout expires [a notification sent before the wait is received immediately].
+ * [Arguments]     : <a_clearOnEntryMask>   -> Indicates to the value bits to be cleared before waiting [ignored
+ *                                             if a notification is already pending].
+ *                   <a_clearOnExitMask>    -> Indicates to the value bits to be cleared after receiving.
+ *                   <a_ptr2value>          -> Pointer to a variable to store the received value [or Null Pointer].
+ *                   <a_timeoutTicks>       -> Indicates to the maximum waiting time [in ticks], Zero to never
+ *                                             wait, Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if a notification is received, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_waitForNotification(uint32 a_clearOnEntryMask, uint32 a_clearOnExitMask, uint32* a_ptr2value, uint32 a_timeoutTicks);
+
 #endif /* MAMOS_TASK_INCLUDES_TASK_H_ */
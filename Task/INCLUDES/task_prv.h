@@ -12,10 +12,101 @@ Description  : Private file for the MamOS Task module.
 #ifndef MAMOS_TASK_INCLUDES_TASK_PRV_H_
 #define MAMOS_TASK_INCLUDES_TASK_PRV_H_
 
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/* Words kept at the bottom of a static task stack buffer, So the MPU guard of the task stays inside the buffer. */
+#if (MAMOS_MPU_PROTECTION == TRUE)
+#define MAMOS_STATIC_STACK_RESERVE            (MAMOS_STACK_GUARD_SIZE)
+#define MAMOS_STATIC_STACK_ALIGN_MASK         ((MAMOS_STACK_GUARD_SIZE * 4U) - 1U)
+#else
+#define MAMOS_STATIC_STACK_RESERVE            (0U)
+#define MAMOS_STATIC_STACK_ALIGN_MASK         (7U)
+#endif
+
+typedef struct
+{
+    void (*ptr2entryPoint)(void);                           /* The task entry point.                                 */
+    uint32* ptr2stackBase;                                  /* The task stack [or Null Pointer to take it from pool]. */
+    uint16 stackSize;                                       /* The total task stack size [in words, even].           */
+    uint8 priority;                                         /* The task priority.                                    */
+    uint16 periodicity;                                     /* The periodic task periodicity [in system ticks].      */
+    uint8 fpuUsage;                                         /* Whether the task uses the FPU or not.                 */
+}MamOS_taskRequestType;
+
+typedef struct
+{
+    MamOS_taskHandle ptr2task;                              /* The task to be notified.                              */
+    uint32 value;                                           /* The bits to be set or the value to be written.        */
+    uint8 action;                                           /* The notify action.                                    */
+    uint32 clearOnEntryMask;                                /* The value bits cleared before waiting.                */
+    uint32 clearOnExitMask;                                 /* The value bits cleared after receiving.               */
+    uint32* ptr2value;                                      /* The variable that receives the value [if any].        */
+    uint32 timeoutTicks;                                    /* Maximum waiting time [in ticks].                      */
+}MamOS_notificationRequestType;
+
+typedef struct
+{
+    MamOS_taskHandle ptr2task;                              /* The task that owns the data region.                   */
+    uint8 regionIndex;                                      /* The index of the data region.                         */
+    uint32 regionBaseAddress;                               /* The MPU RBAR value of the data region.                */
+    uint32 regionAttributes;                                /* The MPU RASR value of the data region.                */
+}MamOS_memoryRegionRequestType;
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Get the total stack size of a task [only the FPU tasks reserve stack space for the FPU context]. */
+#define MAMOS_GET_TASK_STACK_SIZE(SIZE, FPU_USAGE)  ((SIZE) + (((FPU_USAGE) == MAMOS_TASK_FPU_USED) ? MAMOS_FPU_CONTEXT_SIZE : 0))
+
+/* Get the MPU RBAR value of the guard below a stack [the 32-byte region is aligned to its size under the stack]. */
+#define MAMOS_GET_GUARD_RBAR(STACK_BASE)      ((((uint32)(STACK_BASE) - (MAMOS_STACK_GUARD_SIZE * 4U)) & ~((MAMOS_STACK_GUARD_SIZE * 4U) - 1U)) | MAMOS_MPU_RBAR_VALID | MAMOS_MPU_GUARD_REGION)
+
+/* Get the MPU RBAR value of a specific task data region [the data regions follow the stack guard region]. */
+#define MAMOS_GET_REGION_RBAR(BASE, INDEX)    ((uint32)(BASE) | MAMOS_MPU_RBAR_VALID | (MAMOS_MPU_GUARD_REGION + 1U + (INDEX)))
+
+/* Get the MPU RASR value of a task data region [Normal memory, No execution, Privileged RW and the task access]. */
+#define MAMOS_GET_REGION_RASR(SIZE, ACCESS)   (0X10020001UL | (((ACCESS) + 1UL) << 24) | ((30UL - __builtin_clz(SIZE)) << 1))
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setUpTask
+ * [Description]   : Sets up a new task directly before the kernel is launched, Or inside a kernel call after it,
+ *                   As the task queues and the kernel stack pool are shared with the running tasks then.
+ * [Arguments]     : <a_ptr2request>        -> Pointer to the create request.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_setUpTask(MamOS_taskRequestType* a_ptr2request);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createTaskCall
+ * [Description]   : Takes the stack of a new task from the kernel stack pool [if it's not supplied by the user],
+ *                   Then initializes a free task control block for it [runs inside a kernel call after the launch].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the create request.
+ * [return]        : The function returns TRUE if the task is created, FALSE if no task control block or stack is
+ *                   available.
+ ====================================================================================================================*/
+static uint32 MamOS_createTaskCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_initTaskControlBlock
+ * [Description]   : Initializes a free task control block on a specific stack, sets up the stack, and adds the
+ *                   task to the ready queue.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Pointer to the task entry point.
+ *                   <a_ptr2stackBase>      -> Pointer to the lowest address of the task stack.
+ *                   <a_stackSize>          -> Indicates to the total task stack size [in words, even].
+ *                   <a_priority>           -> Indicates to the task priority [0 ~ 255].
+ *                   <a_periodicity>        -> Indicates to the periodic task periodicity [in system ticks].
+ *                   <a_fpuUsage>           -> Indicates whether the task uses the FPU or not.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_initTaskControlBlock(void (*a_ptr2taskEntryPoint)(void), uint32* a_ptr2stackBase, uint16 a_stackSize, uint8 a_priority, uint16 a_periodicity, uint8 a_fpuUsage);
+
 /*=====================================================================================================================
  * [Function Name] : MamOS_initTaskStack
  * [Description]   : Sets up the initial stack frame for a task.
@@ -25,4 +116,78 @@ Description  : Private file for the MamOS Task module.
  ====================================================================================================================*/
 static void MamOS_initTaskStack(void (*a_ptr2taskEntryPoint)(void), uint32** a_ptr2taskStackPointer);
 
+/*=====================================================================================================================
+ * [Function Name] : MamOS_suspendTaskCall
+ * [Description]   : Suspends a specified task from scheduling [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Indicates to the entry point of the required task.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_suspendTaskCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_resumeTaskCall
+ * [Description]   : Resumes a suspended task [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Indicates to the entry point of the required task.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_resumeTaskCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_deleteTaskCall
+ * [Description]   : Deletes a specific task [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the task to be deleted.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_deleteTaskCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setMemoryRegionCall
+ * [Description]   : Sets a data region of a specific task, And programs it at once if the task is running [runs
+ *                   inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the region request.
+ * [return]        : The function returns TRUE [the region is set].
+ ====================================================================================================================*/
+static uint32 MamOS_setMemoryRegionCall(void* a_ptr2argument);
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_applyNotification
+ * [Description]   : Updates the notification value of a specific task, Then wakes it up if it's waiting for a
+ *                   notification [called inside a critical section].
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the task to be notified.
+ *                   <a_value>              -> Indicates to the bits to be set or the value to be written.
+ *                   <a_action>             -> Indicates to the notify action [set bits, increment, or overwrite].
+ * [return]        : The function returns TRUE if the task is woken up, FALSE otherwise.
+ ====================================================================================================================*/
+static uint8 MamOS_applyNotification(MamOS_taskHandle a_ptr2task, uint32 a_value, uint8 a_action);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_receiveNotification
+ * [Description]   : Delivers the notification value of a specific task to its wait request, Then clears the
+ *                   requested bits and the pending notification [called inside a critical section].
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the notified task.
+ *                   <a_ptr2request>        -> Pointer to the wait request of the task.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_receiveNotification(MamOS_taskHandle a_ptr2task, MamOS_notificationRequestType* a_ptr2request);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_notifyTaskCall
+ * [Description]   : Sends a direct notification to a specific task [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the notify request.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_notifyTaskCall(void* a_ptr2argument);
+
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitNotificationCall
+ * [Description]   : Waits for a direct notification to the current task [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the wait request.
+ * [return]        : The function returns TRUE if a notification is received, FALSE if no notification is
+ *                   pending, Or pending if the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_waitNotificationCall(void* a_ptr2argument);
+
 #endif /* MAMOS_TASK_INCLUDES_TASK_PRV_H_ */
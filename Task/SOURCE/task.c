@@ -8,10 +8,9 @@ Description  : Source file for the MamOS Task module.
 =======================================================================================================================
 */
 
-
 /*=====================================================================================================================
  * [Details]     : This module handles task management operations in MamOS,
- *                 including task creation, suspension, resumption, and delay operations.
+ *                 including task creation, deletion, suspension, resumption, and delay operations.
  * [Future Work] : Support more APIs to easily manage tasks.
  *                 Enhance error handling and detection.
  ====================================================================================================================*/
@@ -23,6 +22,12 @@ Description  : Source file for the MamOS Task module.
 #include "../../Others/std_types.h"
 #include "../../Others/kernel_defs.h"
 #include "../../Queue/INCLUDES/queue.h"
+#include "../../Scheduler/INCLUDES/scheduler.h"
+#include "../../Core/INCLUDES/core.h"
+#include "../../Memory/INCLUDES/memory.h"
+#include "../../Mutex/INCLUDES/mutex.h"
+#include "../../RingBuffer/INCLUDES/ring_buffer.h"
+#include "../../System/INCLUDES/system.h"
 #include "../INCLUDES/task_prv.h"
 #include "../INCLUDES/task.h"
 
@@ -33,6 +38,9 @@ Description  : Source file for the MamOS Task module.
 /* Array of task control blocks for all tasks in the system. */
 volatile static MamOS_taskControlBlockType G_taskControlBlocks[MAMOS_TOTAL_NUM_OF_TASKS] = {0};
 
+/* List of the task control blocks of the deleted tasks [linked through their next task links]. */
+static MamOS_taskControlBlockType* G_ptr2freeTaskControlBlocks = NULL_PTR;
+
 /* Extern the Kernel Control Panel. */
 extern MamOS_kernelControlPanelType G_kernelControlPanel;
 
@@ -47,44 +55,213 @@ extern MamOS_kernelControlPanelType G_kernelControlPanel;
  *                   <a_taskStackSize>      -> Indicates to the task stack size [in words].
  *                   <a_priority>           -> Indicates to the task priority [0 ~ 255].
  *                   <a_periodicity>        -> Indicates to the periodic task periodicity [in system ticks].
+ *                   <a_fpuUsage>           -> Indicates whether the task uses the FPU or not, The FPU context is
+ *                                             added to the stack size of the FPU tasks only.
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_createTask(void (*a_ptr2taskEntryPoint)(void), uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity)
+void MamOS_createTask(void (*a_ptr2taskEntryPoint)(void), uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity, uint8 a_fpuUsage)
 {
-    if(G_kernelControlPanel.taskCounter > MAMOS_MAX_NUM_OF_TASKS)
+    if(a_ptr2taskEntryPoint == NULL_PTR)
     {
         /* Invalid Operation. */
     }
 
-    else if(a_ptr2taskEntryPoint == NULL_PTR)
+    else if((a_fpuUsage != MAMOS_TASK_FPU_FREE) && (a_fpuUsage != MAMOS_TASK_FPU_USED))
     {
         /* Invalid Operation. */
     }
 
-    else if(a_taskStackSize > MAMOS_MAX_STACK_SIZE)
+    else if(MAMOS_GET_TASK_STACK_SIZE(a_taskStackSize, a_fpuUsage) > MAMOS_MAX_STACK_SIZE)
     {
         /* Invalid Operation. */
     }
 
     else
     {
-        /* Initialize task control block. */
-        G_taskControlBlocks[G_kernelControlPanel.taskCounter].id = G_kernelControlPanel.taskCounter;
-        G_taskControlBlocks[G_kernelControlPanel.taskCounter].delayTicks = 0;
-        G_taskControlBlocks[G_kernelControlPanel.taskCounter].priority = a_priority;
-        G_taskControlBlocks[G_kernelControlPanel.taskCounter].periodicity = a_periodicity;
-        G_taskControlBlocks[G_kernelControlPanel.taskCounter].stackSize = a_taskStackSize;
-        G_taskControlBlocks[G_kernelControlPanel.taskCounter].ptr2entryPoint = a_ptr2taskEntryPoint;
-        G_taskControlBlocks[G_kernelControlPanel.taskCounter].state = MAMOS_READY_TASK;
-        G_taskControlBlocks[G_kernelControlPanel.taskCounter].stackPointer = G_kernelControlPanel.kernelStackPointer;
-
-        MamOS_initTaskStack(a_ptr2taskEntryPoint, &G_taskControlBlocks[G_kernelControlPanel.taskCounter].stackPointer);
-        MamOS_addToReadyQueue(&G_taskControlBlocks[G_kernelControlPanel.taskCounter]); /* Add it to the ready queue. */
-
-        /* Update the kernel stack pointer and the task counter. */
-        G_kernelControlPanel.kernelStackPointer -= a_taskStackSize;
+        /* The task takes exactly its stack size from the kernel stack pool. */
+        MamOS_taskRequestType LOC_request = {a_ptr2taskEntryPoint, NULL_PTR, MAMOS_ALIGN_STACK_SIZE(MAMOS_GET_TASK_STACK_SIZE(a_taskStackSize, a_fpuUsage)), a_priority, a_periodicity, a_fpuUsage};
+
+        MamOS_setUpTask(&LOC_request);
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createStaticTask
+ * [Description]   : Creates a new task on a stack supplied by the user instead of the kernel stack pool, sets up
+ *                   its stack, and adds it to the ready queue.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Pointer to the task entry point.
+ *                   <a_ptr2taskStack>      -> Pointer to the task stack buffer [8-byte aligned, Or 32-byte aligned
+ *                                             if the MPU stack guards are enabled].
+ *                   <a_taskStackSize>      -> Indicates to the task stack buffer size [in words], It includes the
+ *                                             FPU context of the FPU tasks [and the stack guard words at the
+ *                                             bottom of the buffer if the MPU stack guards are enabled].
+ *                   <a_priority>           -> Indicates to the task priority [0 ~ 255].
+ *                   <a_periodicity>        -> Indicates to the periodic task periodicity [in system ticks].
+ *                   <a_fpuUsage>           -> Indicates whether the task uses the FPU or not.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_createStaticTask(void (*a_ptr2taskEntryPoint)(void), uint32* a_ptr2taskStack, uint16 a_taskStackSize, uint8 a_priority, uint16 a_periodicity, uint8 a_fpuUsage)
+{
+    if(a_ptr2taskEntryPoint == NULL_PTR)
+    {
+        /* Invalid Operation. */
+    }
+
+    else if((a_fpuUsage != MAMOS_TASK_FPU_FREE) && (a_fpuUsage != MAMOS_TASK_FPU_USED))
+    {
+        /* Invalid Operation. */
+    }
+
+    else if((a_ptr2taskStack == NULL_PTR) || (((uint32)a_ptr2taskStack & MAMOS_STATIC_STACK_ALIGN_MASK) != 0))
+    {
+        /* Invalid Operation. */
+    }
+
+    else if(a_taskStackSize < (MAMOS_GET_TASK_STACK_SIZE(MAMOS_MIN_STACK_SIZE, a_fpuUsage) + MAMOS_STATIC_STACK_RESERVE))
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        /* The stack starts above the reserved guard words, And an odd last word is dropped, So the stack top stays
+         * 8-byte aligned. */
+        MamOS_taskRequestType LOC_request = {a_ptr2taskEntryPoint, a_ptr2taskStack + MAMOS_STATIC_STACK_RESERVE, (a_taskStackSize - MAMOS_STATIC_STACK_RESERVE) & ~1U, a_priority, a_periodicity, a_fpuUsage};
+
+        MamOS_setUpTask(&LOC_request);
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setUpTask
+ * [Description]   : Sets up a new task directly before the kernel is launched, Or inside a kernel call after it,
+ *                   As the task queues and the kernel stack pool are shared with the running tasks then.
+ * [Arguments]     : <a_ptr2request>        -> Pointer to the create request.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_setUpTask(MamOS_taskRequestType* a_ptr2request)
+{
+    if(G_kernelControlPanel.ptr2activeTask == NULL_PTR)
+    {
+        MamOS_createTaskCall(a_ptr2request);
+    }
+
+    else
+    {
+        MamOS_kernelCall(MamOS_createTaskCall, a_ptr2request);
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_createTaskCall
+ * [Description]   : Takes the stack of a new task from the kernel stack pool [if it's not supplied by the user],
+ *                   Then initializes a free task control block for it [runs inside a kernel call after the launch].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the create request.
+ * [return]        : The function returns TRUE if the task is created, FALSE if no task control block or stack is
+ *                   available.
+ ====================================================================================================================*/
+static uint32 MamOS_createTaskCall(void* a_ptr2argument)
+{
+    uint32 LOC_result = FALSE;
+    MamOS_taskRequestType* LOC_ptr2request = a_ptr2argument;
+    uint32* LOC_ptr2stackBase = LOC_ptr2request->ptr2stackBase;
+
+    if((G_ptr2freeTaskControlBlocks == NULL_PTR) && (G_kernelControlPanel.taskCounter > MAMOS_MAX_NUM_OF_TASKS))
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        if(LOC_ptr2stackBase == NULL_PTR)
+        {
+            LOC_ptr2stackBase = MamOS_allocateTaskStack(LOC_ptr2request->stackSize);
+        }
+
+        /* The task is created only if the kernel stack pool is not exhausted. */
+        if(LOC_ptr2stackBase != NULL_PTR)
+        {
+            MamOS_initTaskControlBlock(LOC_ptr2request->ptr2entryPoint, LOC_ptr2stackBase, LOC_ptr2request->stackSize, LOC_ptr2request->priority, LOC_ptr2request->periodicity, LOC_ptr2request->fpuUsage);
+            LOC_result = TRUE;
+
+            /* A task created by a running task preempts it if the new task precedes it. */
+            if(G_kernelControlPanel.ptr2activeTask != NULL_PTR)
+            {
+                MamOS_yieldFromISR(TRUE);
+            }
+        }
+    }
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_initTaskControlBlock
+ * [Description]   : Initializes a free task control block on a specific stack, sets up the stack, and adds the
+ *                   task to the ready queue.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Pointer to the task entry point.
+ *                   <a_ptr2stackBase>      -> Pointer to the lowest address of the task stack.
+ *                   <a_stackSize>          -> Indicates to the total task stack size [in words, even].
+ *                   <a_priority>           -> Indicates to the task priority [0 ~ 255].
+ *                   <a_periodicity>        -> Indicates to the periodic task periodicity [in system ticks].
+ *                   <a_fpuUsage>           -> Indicates whether the task uses the FPU or not.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void MamOS_initTaskControlBlock(void (*a_ptr2taskEntryPoint)(void), uint32* a_ptr2stackBase, uint16 a_stackSize, uint8 a_priority, uint16 a_periodicity, uint8 a_fpuUsage)
+{
+    MamOS_taskControlBlockType* LOC_ptr2task = G_ptr2freeTaskControlBlocks;
+
+    /* Reuse the task control block of a deleted task first, Otherwise take the next unused one. */
+    if(LOC_ptr2task != NULL_PTR)
+    {
+        G_ptr2freeTaskControlBlocks = LOC_ptr2task->ptr2nextTask;
+    }
+
+    else
+    {
+        LOC_ptr2task = &G_taskControlBlocks[G_kernelControlPanel.taskCounter];
+        LOC_ptr2task->id = G_kernelControlPanel.taskCounter;
         G_kernelControlPanel.taskCounter++;
     }
+
+    /* Initialize task control block. */
+    LOC_ptr2task->delayTicks = 0;
+    LOC_ptr2task->priority = a_priority;
+    LOC_ptr2task->basePriority = a_priority;
+    LOC_ptr2task->periodicity = a_periodicity;
+    LOC_ptr2task->releaseTick = G_kernelControlPanel.ticksCounter;
+    LOC_ptr2task->deadline = G_kernelControlPanel.ticksCounter + a_periodicity;
+    LOC_ptr2task->stackSize = a_stackSize;
+    LOC_ptr2task->fpuUsage = a_fpuUsage;
+    LOC_ptr2task->notificationValue = 0;
+    LOC_ptr2task->notificationState = MAMOS_NOTIFICATION_NONE;
+    LOC_ptr2task->ptr2waitingQueue = NULL_PTR;
+    LOC_ptr2task->timedWaitFlag = FALSE;
+    LOC_ptr2task->ptr2blockingMutex = NULL_PTR;
+    LOC_ptr2task->ptr2heldMutexes = NULL_PTR;
+    LOC_ptr2task->ptr2entryPoint = a_ptr2taskEntryPoint;
+    LOC_ptr2task->state = MAMOS_READY_TASK;
+    LOC_ptr2task->ptr2stackBase = a_ptr2stackBase;
+    LOC_ptr2task->stackPointer = a_ptr2stackBase + a_stackSize;
+
+    /* Paint the whole stack, So its usage can be measured and its overflow can be detected. */
+    for(uint32* LOC_ptr2stackWord = a_ptr2stackBase; LOC_ptr2stackWord < LOC_ptr2task->stackPointer; LOC_ptr2stackWord++)
+    {
+        *LOC_ptr2stackWord = MAMOS_STACK_FILL_PATTERN;
+    }
+
+    /* Guard the bottom of the stack by the MPU, And leave the data regions of the task disabled. */
+    LOC_ptr2task->mpuRegions[0] = MAMOS_GET_GUARD_RBAR(a_ptr2stackBase);
+    LOC_ptr2task->mpuRegions[1] = MAMOS_MPU_GUARD_RASR;
+
+    for(uint8 LOC_regionIndex = 0; LOC_regionIndex < MAMOS_MPU_NUM_OF_DATA_REGIONS; LOC_regionIndex++)
+    {
+        LOC_ptr2task->mpuRegions[2U * (LOC_regionIndex + 1U)] = MAMOS_GET_REGION_RBAR(0, LOC_regionIndex);
+        LOC_ptr2task->mpuRegions[(2U * (LOC_regionIndex + 1U)) + 1U] = 0;
+    }
+
+    MamOS_initTaskStack(a_ptr2taskEntryPoint, &LOC_ptr2task->stackPointer);
+    MamOS_addToReadyQueue(LOC_ptr2task);                                               /* Add it to the ready queue. */
 }
 
 /*=====================================================================================================================
@@ -112,6 +289,9 @@ static void MamOS_initTaskStack(void (*a_ptr2taskEntryPoint)(void), uint32** a_p
         (**a_ptr2taskStackPointer) = 0X00000000;
     }
 
+    (*a_ptr2taskStackPointer)--;
+    (**a_ptr2taskStackPointer) = MAMOS_INITIAL_EXC_RETURN;             /* Set up the EXC_RETURN value [no FP frame]. */
+
     /* Set up the {R4-R11} registers value [optional]. */
     for(uint8 counter = 0; counter < 8; counter++)
     {
@@ -128,10 +308,340 @@ static void MamOS_initTaskStack(void (*a_ptr2taskEntryPoint)(void), uint32** a_p
  ====================================================================================================================*/
 void MamOS_suspendTask(void (*a_ptr2taskEntryPoint)(void))
 {
+    MamOS_kernelCall(MamOS_suspendTaskCall, (void*)a_ptr2taskEntryPoint);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_resumeTask
+ * [Description]   : Resumes a suspended task.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Indicates to the required task to be resumed.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_resumeTask(void (*a_ptr2taskEntryPoint)(void))
+{
+    MamOS_kernelCall(MamOS_resumeTaskCall, (void*)a_ptr2taskEntryPoint);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_deleteTask
+ * [Description]   : Deletes a specific task, It's removed from the queue that holds it, Its mutexes are handed
+ *                   over to their waiting tasks, Its stack returns to the kernel stack pool [if it's taken from it],
+ *                   And its task control block is reused by the next created task. A task that deletes itself is
+ *                   switched out at once and never returns [the idle task can't be deleted].
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_deleteTask(MamOS_taskHandle a_ptr2task)
+{
+    MamOS_taskControlBlockType* LOC_ptr2task = (a_ptr2task == NULL_PTR) ? G_kernelControlPanel.ptr2activeTask : a_ptr2task;
+
+    /* The task queues and the mutexes are shared with the interrupts, So they are only modified inside a kernel
+     * call [the kernel call of a task that deletes itself is followed by the switch to another task]. */
+    MamOS_kernelCall(MamOS_deleteTaskCall, LOC_ptr2task);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_resumeTaskFromISR
+ * [Description]   : Resumes a suspended task from an interrupt context, The context switch is left to
+ *                   MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2taskEntryPoint>        -> Indicates to the required task to be resumed.
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the resumed
+ *                                                    task precedes the task going to run next [never cleared].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_resumeTaskFromISR(void (*a_ptr2taskEntryPoint)(void), uint8* a_ptr2higherPriorityTaskWoken)
+{
+    MamOS_enterCritical();
+
     /* Search for the required task. */
     for(uint8 iterator = 1; iterator < G_kernelControlPanel.taskCounter; iterator++)
     {
         if(G_taskControlBlocks[iterator].ptr2entryPoint == a_ptr2taskEntryPoint)
+        {
+            /* Only a suspended task can be resumed [a task must never be linked twice in the ready queue]. */
+            if(G_taskControlBlocks[iterator].state == MAMOS_SUSPENDED_TASK)
+            {
+                MamOS_addToReadyQueue(&G_taskControlBlocks[iterator]);
+
+                /* Report if the resumed task should preempt the task going to run next. */
+                if((a_ptr2higherPriorityTaskWoken != NULL_PTR) &&
+                   (MamOS_isTaskPreceding(&G_taskControlBlocks[iterator], G_kernelControlPanel.ptr2standbyTask) == TRUE))
+                {
+                    *a_ptr2higherPriorityTaskWoken = TRUE;
+                }
+            }
+
+            break; /* Task found and resumed, exit the loop. */
+        }
+    }
+
+    MamOS_exitCritical();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_taskDelay
+ * [Description]   : Delays the current task for a specified number of ticks.
+ * [Arguments]     : <a_delayTicks> -> Indicates to the number of ticks to delay the task [up to 2^31 - 1].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_taskDelay(uint32 a_delayTicks)
+{
+    /* Set the delay for the active task with a specific value and request a task transition. */
+    G_kernelControlPanel.ptr2activeTask->delayTicks = a_delayTicks;
+    MAMOS_TASK_TRANS_REQUEST();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_taskDelayUntil
+ * [Description]   : Delays the current task until a specific number of ticks after its last wake-up tick,
+ *                   So a periodic task is released at a fixed rate regardless of its execution time.
+ * [Arguments]     : <a_ptr2lastWakeTick> -> Pointer to the last wake-up tick held by the task [initialized with
+ *                                           MamOS_getTickCount, So it's 64-bit too], It's updated with the next
+ *                                           wake-up tick.
+ *                   <a_periodTicks>      -> Indicates to the number of ticks between the wake-up ticks.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_taskDelayUntil(uint64* a_ptr2lastWakeTick, uint32 a_periodTicks)
+{
+    if(a_ptr2lastWakeTick == NULL_PTR)
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        /* The next wake-up tick is always relative to the previous one, So the execution time never drifts it [the
+         * release tick keeps its low word, As the release tick comparisons are wrap-safe]. */
+        *a_ptr2lastWakeTick += a_periodTicks;
+        G_kernelControlPanel.ptr2activeTask->releaseTick = (uint32)*a_ptr2lastWakeTick;
+        G_kernelControlPanel.ptr2activeTask->deadline = G_kernelControlPanel.ptr2activeTask->releaseTick + G_kernelControlPanel.ptr2activeTask->periodicity;
+        MAMOS_TASK_RELEASE_REQUEST();
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_taskYield
+ * [Description]   : Yields the current task after finishing its function allowing other tasks to run.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_taskYield(void)
+{
+    /* The next job is released one period after the previous release [not after the yield], So it never drifts. */
+    G_kernelControlPanel.ptr2activeTask->releaseTick += G_kernelControlPanel.ptr2activeTask->periodicity;
+    G_kernelControlPanel.ptr2activeTask->deadline = G_kernelControlPanel.ptr2activeTask->releaseTick + G_kernelControlPanel.ptr2activeTask->periodicity;
+    MAMOS_TASK_RELEASE_REQUEST();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_taskYieldToPeers
+ * [Description]   : Gives up the rest of the current time slice to the ready tasks with the same priority,
+ *                   The current task stays ready and runs again after its peers [or immediately if none].
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_taskYieldToPeers(void)
+{
+    /* A zero delay moves the task to the rear of its priority list, So the equal priority peers run first. */
+    G_kernelControlPanel.ptr2activeTask->delayTicks = 0;
+    MAMOS_TASK_TRANS_REQUEST();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTaskHandle
+ * [Description]   : Gets the handle of a specific task, So it can be notified directly without searching for it.
+ * [Arguments]     : <a_ptr2taskEntryPoint> -> Indicates to the required task.
+ * [return]        : The function returns the handle to the required task [or Null Pointer if it's not found].
+ ====================================================================================================================*/
+MamOS_taskHandle MamOS_getTaskHandle(void (*a_ptr2taskEntryPoint)(void))
+{
+    MamOS_taskHandle LOC_ptr2task = NULL_PTR;
+
+    /* Search for the required task [the idle task is never notified]. */
+    for(uint8 iterator = 1; iterator < G_kernelControlPanel.taskCounter; iterator++)
+    {
+        if((G_taskControlBlocks[iterator].ptr2entryPoint == a_ptr2taskEntryPoint) && (G_taskControlBlocks[iterator].state != MAMOS_DELETED_TASK))
+        {
+            LOC_ptr2task = (MamOS_taskHandle)&G_taskControlBlocks[iterator];
+            break; /* Task found, exit the loop. */
+        }
+    }
+
+    return LOC_ptr2task;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_getTaskStackHighWater
+ * [Description]   : Gets the minimum number of free words that a specific task ever left in its stack, The whole
+ *                   stack is painted at creation, So the words at the bottom of the stack that still hold the paint
+ *                   were never used.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ * [return]        : The function returns the minimum remaining free words of the task stack.
+ ====================================================================================================================*/
+uint32 MamOS_getTaskStackHighWater(MamOS_taskHandle a_ptr2task)
+{
+    MamOS_taskControlBlockType* LOC_ptr2task = (a_ptr2task == NULL_PTR) ? G_kernelControlPanel.ptr2activeTask : a_ptr2task;
+    uint32 LOC_freeWords = 0;
+
+    /* The stack grows downward, So count the painted words from its bottom up to the first used word. */
+    while((LOC_freeWords < LOC_ptr2task->stackSize) && (LOC_ptr2task->ptr2stackBase[LOC_freeWords] == MAMOS_STACK_FILL_PATTERN))
+    {
+        LOC_freeWords++;
+    }
+
+    return LOC_freeWords;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_setTaskMemoryRegion
+ * [Description]   : Sets one of the MPU data regions of a specific task, So the task access to the region is
+ *                   limited [read only or no access] while the task is running, Any denied access faults at once.
+ *                   The regions take effect only if MAMOS_MPU_PROTECTION is enabled.
+ * [Arguments]     : <a_ptr2task>           -> Handle to the required task [or Null Pointer for the calling task].
+ *                   <a_regionIndex>        -> Indicates to the data region index [0 ~ 1].
+ *                   <a_ptr2regionBase>     -> Pointer to the region base [aligned to the region size].
+ *                   <a_regionSize>         -> Indicates to the region size [in bytes, a power of 2 from 32 bytes],
+ *                                             Or zero to disable the data region.
+ *                   <a_access>             -> Indicates to the task access: - MAMOS_REGION_NO_ACCESS.
+ *                                                                          - MAMOS_REGION_READ_ONLY.
+ *                                                                          - MAMOS_REGION_READ_WRITE.
+ * [return]        : The function returns TRUE if the region is set, FALSE if the region is invalid.
+ ====================================================================================================================*/
+uint8 MamOS_setTaskMemoryRegion(MamOS_taskHandle a_ptr2task, uint8 a_regionIndex, void* a_ptr2regionBase, uint32 a_regionSize, uint8 a_access)
+{
+    uint8 LOC_result = TRUE;
+    MamOS_memoryRegionRequestType LOC_request = {a_ptr2task, a_regionIndex, 0, 0};
+
+    if(a_ptr2task == NULL_PTR)
+    {
+        LOC_request.ptr2task = G_kernelControlPanel.ptr2activeTask;
+    }
+
+    if((a_regionIndex >= MAMOS_MPU_NUM_OF_DATA_REGIONS) || (a_access > MAMOS_REGION_READ_WRITE))
+    {
+        LOC_result = FALSE;
+    }
+
+    else if(a_regionSize == 0)
+    {
+        /* A disabled region keeps only its region number. */
+        LOC_request.regionBaseAddress = MAMOS_GET_REGION_RBAR(0, a_regionIndex);
+    }
+
+    else if((a_regionSize < 32U) || ((a_regionSize & (a_regionSize - 1U)) != 0) || (((uint32)a_ptr2regionBase & (a_regionSize - 1U)) != 0))
+    {
+        LOC_result = FALSE;
+    }
+
+    else
+    {
+        LOC_request.regionBaseAddress = MAMOS_GET_REGION_RBAR(a_ptr2regionBase, a_regionIndex);
+        LOC_request.regionAttributes = MAMOS_GET_REGION_RASR(a_regionSize, a_access);
+    }
+
+    if(LOC_result == TRUE)
+    {
+        LOC_result = (uint8)MamOS_kernelCall(MamOS_setMemoryRegionCall, &LOC_request);
+    }
+
+    return LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_notifyTask
+ * [Description]   : Sends a direct notification to a specific task, Then wakes it up if it's waiting for a
+ *                   notification and switches to it if it precedes the current task [no queue is searched].
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the task to be notified.
+ *                   <a_value>              -> Indicates to the bits to be set or the value to be written.
+ *                   <a_action>             -> Indicates to the notify action: - MAMOS_NOTIFY_SET_BITS.
+ *                                                                            - MAMOS_NOTIFY_INCREMENT.
+ *                                                                            - MAMOS_NOTIFY_OVERWRITE.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_notifyTask(MamOS_taskHandle a_ptr2task, uint32 a_value, uint8 a_action)
+{
+    MamOS_notificationRequestType LOC_request = {0};
+
+    LOC_request.ptr2task = a_ptr2task;
+    LOC_request.value = a_value;
+    LOC_request.action = a_action;
+
+    MamOS_kernelCall(MamOS_notifyTaskCall, &LOC_request);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_notifyTaskFromISR
+ * [Description]   : Sends a direct notification to a specific task from an interrupt, The context switch to the
+ *                   woken task is left to MamOS_yieldFromISR at the end of the interrupt.
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the task to be notified.
+ *                   <a_value>              -> Indicates to the bits to be set or the value to be written.
+ *                   <a_action>             -> Indicates to the notify action [set bits, increment, or overwrite].
+ *                   <a_ptr2higherPriorityTaskWoken> -> Pointer to a variable that is set to TRUE if the woken
+ *                                                    task precedes the task going to run next.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void MamOS_notifyTaskFromISR(MamOS_taskHandle a_ptr2task, uint32 a_value, uint8 a_action, uint8* a_ptr2higherPriorityTaskWoken)
+{
+    MamOS_enterCritical();
+
+    /* Report if the woken task should preempt the task going to run next. */
+    if((MamOS_applyNotification(a_ptr2task, a_value, a_action) == TRUE) && (a_ptr2higherPriorityTaskWoken != NULL_PTR))
+    {
+        if(MamOS_isTaskPreceding(a_ptr2task, G_kernelControlPanel.ptr2standbyTask) == TRUE)
+        {
+            *a_ptr2higherPriorityTaskWoken = TRUE;
+        }
+    }
+
+    MamOS_exitCritical();
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitForNotification
+ * [Description]   : Waits for a direct notification to the current task, The task is blocked until it's notified
+ *                   or the timeout expires [a notification sent before the wait is received immediately].
+ * [Arguments]     : <a_clearOnEntryMask>   -> Indicates to the value bits to be cleared before waiting [ignored
+ *                                             if a notification is already pending].
+ *                   <a_clearOnExitMask>    -> Indicates to the value bits to be cleared after receiving.
+ *                   <a_ptr2value>          -> Pointer to a variable to store the received value [or Null Pointer].
+ *                   <a_timeoutTicks>       -> Indicates to the maximum waiting time [in ticks], Zero to never
+ *                                             wait, Or MAMOS_WAIT_FOREVER to wait without a timeout.
+ * [return]        : The function returns TRUE if a notification is received, FALSE if the timeout expired.
+ ====================================================================================================================*/
+uint8 MamOS_waitForNotification(uint32 a_clearOnEntryMask, uint32 a_clearOnExitMask, uint32* a_ptr2value, uint32 a_timeoutTicks)
+{
+    uint32 LOC_result = FALSE;
+    MamOS_notificationRequestType LOC_request = {0};
+
+    LOC_request.clearOnEntryMask = a_clearOnEntryMask;
+    LOC_request.clearOnExitMask = a_clearOnExitMask;
+    LOC_request.ptr2value = a_ptr2value;
+    LOC_request.timeoutTicks = a_timeoutTicks;
+
+    LOC_result = MamOS_kernelCall(MamOS_waitNotificationCall, &LOC_request);
+
+    /* The task was blocked, So the result is known only after it's notified or the timeout expires. */
+    if(LOC_result == MAMOS_WAIT_RESULT_PENDING)
+    {
+        LOC_result = G_kernelControlPanel.ptr2activeTask->waitResult;
+    }
+
+    return (uint8)LOC_result;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_suspendTaskCall
+ * [Description]   : Suspends a specified task from scheduling [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Indicates to the entry point of the required task.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_suspendTaskCall(void* a_ptr2argument)
+{
+    /* Search for the required task. */
+    for(uint8 iterator = 1; iterator < G_kernelControlPanel.taskCounter; iterator++)
+    {
+        /* A deleted task has no entry point, So it's skipped. */
+        if((G_taskControlBlocks[iterator].ptr2entryPoint == (void (*)(void))a_ptr2argument) && (G_taskControlBlocks[iterator].state != MAMOS_DELETED_TASK))
         {
             if(G_taskControlBlocks[iterator].state == MAMOS_READY_TASK)
             {
@@ -143,53 +653,261 @@ void MamOS_suspendTask(void (*a_ptr2taskEntryPoint)(void))
                 MamOS_removeFromBlockedQueue(&G_taskControlBlocks[iterator]);
             }
 
+            /* A suspended task stops waiting, So no timeout or signal readies it, And it's resumed with a FALSE
+             * wait result [a mutex waiter waits for the mutex again]. */
+            else if(G_taskControlBlocks[iterator].state == MAMOS_WAITING_TASK)
+            {
+                MamOS_cancelWait(&G_taskControlBlocks[iterator]);
+                MamOS_releaseTaskRingBuffers(&G_taskControlBlocks[iterator]);
+                MamOS_leaveBlockingMutex(&G_taskControlBlocks[iterator]);
+            }
+
             G_taskControlBlocks[iterator].state = MAMOS_SUSPENDED_TASK;
+
+            /* A task that suspended itself is switched out at once. */
+            if(&G_taskControlBlocks[iterator] == G_kernelControlPanel.ptr2activeTask)
+            {
+                MamOS_forceTaskTransition();
+            }
+
             break; /* Task found and suspended, exit the loop. */
         }
     }
+
+    return 0;
 }
 
 /*=====================================================================================================================
- * [Function Name] : MamOS_resumeTask
- * [Description]   : Resumes a suspended task.
- * [Arguments]     : <a_ptr2taskEntryPoint> -> Indicates to the required task to be resumed.
- * [return]        : The function returns void.
+ * [Function Name] : MamOS_resumeTaskCall
+ * [Description]   : Resumes a suspended task [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Indicates to the entry point of the required task.
+ * [return]        : The function returns zero [no result].
  ====================================================================================================================*/
-void MamOS_resumeTask(void (*a_ptr2taskEntryPoint)(void))
+static uint32 MamOS_resumeTaskCall(void* a_ptr2argument)
 {
     /* Search for the required task. */
     for(uint8 iterator = 1; iterator < G_kernelControlPanel.taskCounter; iterator++)
     {
-        if(G_taskControlBlocks[iterator].ptr2entryPoint == a_ptr2taskEntryPoint)
+        if(G_taskControlBlocks[iterator].ptr2entryPoint == (void (*)(void))a_ptr2argument)
         {
-            MamOS_addToReadyQueue(&G_taskControlBlocks[iterator]);
+            /* Only a suspended task can be resumed [a task must never be linked twice in the ready queue]. */
+            if(G_taskControlBlocks[iterator].state == MAMOS_SUSPENDED_TASK)
+            {
+                MamOS_addToReadyQueue(&G_taskControlBlocks[iterator]);
+                MamOS_yieldFromISR(MamOS_isTaskPreceding(&G_taskControlBlocks[iterator], G_kernelControlPanel.ptr2standbyTask));
+            }
+
             break; /* Task found and resumed, exit the loop. */
         }
     }
+
+    return 0;
 }
 
 /*=====================================================================================================================
- * [Function Name] : MamOS_taskDelay
- * [Description]   : Delays the current task for a specified number of ticks.
- * [Arguments]     : <a_delayTicks> -> Indicates to the number of ticks to delay the task.
- * [return]        : The function returns void.
+ * [Function Name] : MamOS_deleteTaskCall
+ * [Description]   : Deletes a specific task [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the task to be deleted.
+ * [return]        : The function returns zero [no result].
  ====================================================================================================================*/
-void MamOS_taskDelay(uint16 a_delayTicks)
+static uint32 MamOS_deleteTaskCall(void* a_ptr2argument)
 {
-    /* Set the delay for the active task with a specific value and request a task transition. */
-    G_kernelControlPanel.ptr2activeTask->delayTicks = a_delayTicks;
-    MAMOS_TASK_TRANS_REQUEST();
+    MamOS_taskControlBlockType* LOC_ptr2task = a_ptr2argument;
+
+    if((LOC_ptr2task->id == MAMOS_IDLE_TASK_ID) || (LOC_ptr2task->state == MAMOS_DELETED_TASK))
+    {
+        /* Invalid Operation. */
+    }
+
+    else
+    {
+        /* Remove the task from the queues that hold it [the running task is in none of them]. */
+        if(LOC_ptr2task->state == MAMOS_READY_TASK)
+        {
+            MamOS_removeFromReadyQueue(LOC_ptr2task);
+        }
+
+        else if(LOC_ptr2task->state == MAMOS_BLOCKED_TASK)
+        {
+            MamOS_removeFromBlockedQueue(LOC_ptr2task);
+        }
+
+        else if(LOC_ptr2task->state == MAMOS_WAITING_TASK)
+        {
+            MamOS_cancelWait(LOC_ptr2task);
+            MamOS_releaseTaskRingBuffers(LOC_ptr2task);
+        }
+
+        MamOS_releaseTaskMutexes(LOC_ptr2task);
+        MamOS_freeTaskStack(LOC_ptr2task->ptr2stackBase, LOC_ptr2task->stackSize);
+
+        /* The deleted task can't be found by its entry point, And its task control block is reused first. */
+        LOC_ptr2task->state = MAMOS_DELETED_TASK;
+        LOC_ptr2task->ptr2entryPoint = NULL_PTR;
+        LOC_ptr2task->ptr2nextTask = G_ptr2freeTaskControlBlocks;
+        G_ptr2freeTaskControlBlocks = LOC_ptr2task;
+
+        /* A task that deleted itself is switched out at once [PendSV only saves its context to the freed stack,
+         * As no task can be created before the switch], Otherwise a task woken by a handed over mutex may now
+         * precede the running task. */
+        if(LOC_ptr2task == G_kernelControlPanel.ptr2activeTask)
+        {
+            MamOS_forceTaskTransition();
+        }
+
+        else
+        {
+            MamOS_yieldFromISR(TRUE);
+        }
+    }
+
+    return 0;
 }
 
 /*=====================================================================================================================
- * [Function Name] : MamOS_taskYield
- * [Description]   : Yields the current task after finishing its function allowing other tasks to run.
- * [Arguments]     : The function Takes no arguments.
+ * [Function Name] : MamOS_setMemoryRegionCall
+ * [Description]   : Sets a data region of a specific task, And programs it at once if the task is running [runs
+ *                   inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the region request.
+ * [return]        : The function returns TRUE [the region is set].
+ ====================================================================================================================*/
+static uint32 MamOS_setMemoryRegionCall(void* a_ptr2argument)
+{
+    MamOS_memoryRegionRequestType* LOC_ptr2request = a_ptr2argument;
+    uint32* LOC_ptr2region = &LOC_ptr2request->ptr2task->mpuRegions[2U * (LOC_ptr2request->regionIndex + 1U)];
+
+    LOC_ptr2region[0] = LOC_ptr2request->regionBaseAddress;
+    LOC_ptr2region[1] = LOC_ptr2request->regionAttributes;
+
+    /* The regions of the other tasks are programmed on their context switch. */
+    #if (MAMOS_MPU_PROTECTION == TRUE)
+    if(LOC_ptr2request->ptr2task == G_kernelControlPanel.ptr2activeTask)
+    {
+        SYSTEM_setMemoryRegion(LOC_ptr2region[0], LOC_ptr2region[1]);
+    }
+    #endif
+
+    return TRUE;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_applyNotification
+ * [Description]   : Updates the notification value of a specific task, Then wakes it up if it's waiting for a
+ *                   notification [called inside a critical section].
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the task to be notified.
+ *                   <a_value>              -> Indicates to the bits to be set or the value to be written.
+ *                   <a_action>             -> Indicates to the notify action [set bits, increment, or overwrite].
+ * [return]        : The function returns TRUE if the task is woken up, FALSE otherwise.
+ ====================================================================================================================*/
+static uint8 MamOS_applyNotification(MamOS_taskHandle a_ptr2task, uint32 a_value, uint8 a_action)
+{
+    uint8 LOC_wokenFlag = FALSE;
+
+    if(a_action == MAMOS_NOTIFY_SET_BITS)
+    {
+        a_ptr2task->notificationValue |= a_value;
+    }
+
+    else if(a_action == MAMOS_NOTIFY_INCREMENT)
+    {
+        a_ptr2task->notificationValue++;
+    }
+
+    else
+    {
+        a_ptr2task->notificationValue = a_value;
+    }
+
+    /* A waiting task receives the notification at once, So it finds its value ready when it runs. */
+    if(a_ptr2task->notificationState == MAMOS_NOTIFICATION_WAITING)
+    {
+        MamOS_receiveNotification(a_ptr2task, a_ptr2task->ptr2waitingData);
+        MamOS_wakeFromWaitingQueue(a_ptr2task);
+        LOC_wokenFlag = TRUE;
+    }
+
+    else
+    {
+        a_ptr2task->notificationState = MAMOS_NOTIFICATION_PENDING;
+    }
+
+    return LOC_wokenFlag;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_receiveNotification
+ * [Description]   : Delivers the notification value of a specific task to its wait request, Then clears the
+ *                   requested bits and the pending notification [called inside a critical section].
+ * [Arguments]     : <a_ptr2task>           -> Pointer to the notified task.
+ *                   <a_ptr2request>        -> Pointer to the wait request of the task.
  * [return]        : The function returns void.
  ====================================================================================================================*/
-void MamOS_taskYield(void)
+static void MamOS_receiveNotification(MamOS_taskHandle a_ptr2task, MamOS_notificationRequestType* a_ptr2request)
 {
-    /* Set the delay for the active task to its periodicity and request a task transition. */
-    G_kernelControlPanel.ptr2activeTask->delayTicks = G_kernelControlPanel.ptr2activeTask->periodicity;
-    MAMOS_TASK_TRANS_REQUEST();
+    if(a_ptr2request->ptr2value != NULL_PTR)
+    {
+        *a_ptr2request->ptr2value = a_ptr2task->notificationValue;
+    }
+
+    a_ptr2task->notificationValue &= ~(a_ptr2request->clearOnExitMask);
+    a_ptr2task->notificationState = MAMOS_NOTIFICATION_NONE;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_notifyTaskCall
+ * [Description]   : Sends a direct notification to a specific task [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the notify request.
+ * [return]        : The function returns zero [no result].
+ ====================================================================================================================*/
+static uint32 MamOS_notifyTaskCall(void* a_ptr2argument)
+{
+    MamOS_notificationRequestType* LOC_ptr2request = a_ptr2argument;
+
+    if(MamOS_applyNotification(LOC_ptr2request->ptr2task, LOC_ptr2request->value, LOC_ptr2request->action) == TRUE)
+    {
+        MamOS_yieldFromISR(MamOS_isTaskPreceding(LOC_ptr2request->ptr2task, G_kernelControlPanel.ptr2standbyTask));
+    }
+
+    return 0;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : MamOS_waitNotificationCall
+ * [Description]   : Waits for a direct notification to the current task [runs inside a kernel call].
+ * [Arguments]     : <a_ptr2argument> -> Pointer to the wait request.
+ * [return]        : The function returns TRUE if a notification is received, FALSE if no notification is
+ *                   pending, Or pending if the task is blocked.
+ ====================================================================================================================*/
+static uint32 MamOS_waitNotificationCall(void* a_ptr2argument)
+{
+    uint32 LOC_result = TRUE;
+    MamOS_notificationRequestType* LOC_ptr2request = a_ptr2argument;
+    MamOS_taskHandle LOC_ptr2activeTask = G_kernelControlPanel.ptr2activeTask;
+
+    if(LOC_ptr2activeTask->notificationState == MAMOS_NOTIFICATION_PENDING)
+    {
+        MamOS_receiveNotification(LOC_ptr2activeTask, LOC_ptr2request);
+    }
+
+    else
+    {
+        LOC_ptr2activeTask->notificationValue &= ~(LOC_ptr2request->clearOnEntryMask);
+
+        if(LOC_ptr2request->timeoutTicks == 0)
+        {
+            LOC_result = FALSE;
+        }
+
+        else
+        {
+            /* The task waits without a waiting queue, Its request is kept for the notifier to deliver the value. */
+            LOC_ptr2activeTask->ptr2waitingData = LOC_ptr2request;
+            LOC_ptr2activeTask->notificationState = MAMOS_NOTIFICATION_WAITING;
+            MamOS_addToWaitingQueue(NULL_PTR, LOC_ptr2activeTask, LOC_ptr2request->timeoutTicks);
+            MamOS_forceTaskTransition();
+            LOC_result = MAMOS_WAIT_RESULT_PENDING;
+        }
+    }
+
+    return LOC_result;
 }
@@ -37,6 +37,30 @@ typedef enum
  ====================================================================================================================*/
 TIMER_errorStatusType TIMER_setPeriodicInterval(uint16 a_timeInterval);
 
+/*=====================================================================================================================
+ * [Function Name] : TIMER_stretchPeriodicInterval
+ * [Description]   : Stretch the current periodic interval to expire after a specific number of intervals,
+ *                   so the intermediate periodic interrupts are suppressed [used for tickless idle].
+ * [Arguments]     : <a_ptr2intervalsCount> -> Pointer to the required number of intervals, It's updated with
+ *                                             the actual number of intervals if clamped to the timer limit.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+TIMER_errorStatusType TIMER_stretchPeriodicInterval(uint32* a_ptr2intervalsCount);
+
+/*=====================================================================================================================
+ * [Function Name] : TIMER_restorePeriodicInterval
+ * [Description]   : Restore the periodic interval after stretching it, The counter keeps running and restarts
+ *                   a whole interval, So the part of the interval that already elapsed is carried to the next
+ *                   restore instead of being dropped [the counted intervals never drift from the elapsed time].
+ * [Arguments]     : <a_ptr2elapsedIntervals> -> Pointer to a variable to store the number of complete intervals
+ *                                               that elapsed while stretched [excluding a pending interrupt,
+ *                                               and always fewer than the stretched intervals].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+TIMER_errorStatusType TIMER_restorePeriodicInterval(uint32* a_ptr2elapsedIntervals);
+
 /*=====================================================================================================================
  * [Function Name] : TIMER_setCallBackFunction
  * [Description]   : Set the address of the call-back function.
@@ -28,6 +28,11 @@ Description  : Source file for the Timer module used in MamOS.
 =====================================================================================================================*/
 
 static void (*G_ptr2callBackFunction)(void) = NULL_PTR;                  /* Pointer to the call-back function. */
+static uint32 G_intervalTicks = 0;                                  /* Number of timer ticks in one interval. */
+static uint32 G_stretchedTicks = 0;                                 /* Number of timer ticks while stretched. */
+static uint32 G_stretchOffsetTicks = 0;                             /* Ticks of the interval before stretch.  */
+static uint32 G_stretchedIntervals = 0;                             /* Number of intervals while stretched.   */
+static uint32 G_carriedTicks = 0;                                   /* Elapsed timer ticks not counted yet.   */
 
 /*=====================================================================================================================
                                           < Functions Definitions >
@@ -54,6 +59,7 @@ TIMER_errorStatusType TIMER_setPeriodicInterval(uint16 a_timeInterval)
     {
         SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_CLKSOURCE_BIT);           /* Set SysTick clock as the CPU clock.    */
         SYSTICK->LOAD = TIMER_GET_TICKS_COUNT(a_timeInterval);       /* Calculate and Set the number of ticks. */
+        G_intervalTicks = SYSTICK->LOAD + 1;                         /* Keep the interval length for stretch.  */
         SYSTICK->VAL = 0;                                            /* Reset the Current Value Register.      */
         SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_TICKINT_BIT);             /* Enable SysTick interrupt.              */
         SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_ENABLE_BIT);              /* Enable SysTick counter.                */
@@ -62,6 +68,107 @@ TIMER_errorStatusType TIMER_setPeriodicInterval(uint16 a_timeInterval)
     return LOC_errorStatus;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : TIMER_stretchPeriodicInterval
+ * [Description]   : Stretch the current periodic interval to expire after a specific number of intervals,
+ *                   so the intermediate periodic interrupts are suppressed [used for tickless idle].
+ * [Arguments]     : <a_ptr2intervalsCount> -> Pointer to the required number of intervals, It's updated with
+ *                                             the actual number of intervals if clamped to the timer limit.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+TIMER_errorStatusType TIMER_stretchPeriodicInterval(uint32* a_ptr2intervalsCount)
+{
+    TIMER_errorStatusType LOC_errorStatus = TIMER_NO_ERRORS;
+
+    if(a_ptr2intervalsCount == NULL_PTR)
+    {
+        LOC_errorStatus = TIMER_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        uint32 LOC_remainingTicks = 0;
+
+        /* Clamp the required number of intervals to the timer limit. */
+        if(*a_ptr2intervalsCount > (TIMER_MAX_TICKS / G_intervalTicks))
+        {
+            *a_ptr2intervalsCount = (TIMER_MAX_TICKS / G_intervalTicks);
+        }
+
+        /* The counter keeps running [a stopped counter drops the ticks], So the remaining part of the current
+         * interval is read from VAL and the stretched interval still ends on a boundary. */
+        LOC_remainingTicks = SYSTICK->VAL;
+        LOC_remainingTicks = (LOC_remainingTicks == 0) ? G_intervalTicks : LOC_remainingTicks;
+        G_stretchOffsetTicks = G_intervalTicks - LOC_remainingTicks;
+        G_stretchedTicks = LOC_remainingTicks + ((*a_ptr2intervalsCount - 1) * G_intervalTicks);
+        G_stretchedIntervals = *a_ptr2intervalsCount;
+
+        SYSTICK->LOAD = G_stretchedTicks - 1;                        /* Set the stretched number of ticks.     */
+        SYSTICK->VAL = 0;                                            /* Reload now [it clears COUNTFLAG too].  */
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : TIMER_restorePeriodicInterval
+ * [Description]   : Restore the periodic interval after stretching it, The counter keeps running and restarts
+ *                   a whole interval, So the part of the interval that already elapsed is carried to the next
+ *                   restore instead of being dropped [the counted intervals never drift from the elapsed time].
+ * [Arguments]     : <a_ptr2elapsedIntervals> -> Pointer to a variable to store the number of complete intervals
+ *                                               that elapsed while stretched [excluding a pending interrupt,
+ *                                               and always fewer than the stretched intervals].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+TIMER_errorStatusType TIMER_restorePeriodicInterval(uint32* a_ptr2elapsedIntervals)
+{
+    TIMER_errorStatusType LOC_errorStatus = TIMER_NO_ERRORS;
+
+    if(a_ptr2elapsedIntervals == NULL_PTR)
+    {
+        LOC_errorStatus = TIMER_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        uint32 LOC_elapsedTicks = 0;
+        uint32 LOC_currentTicks = SYSTICK->VAL;                      /* Valid if the stretch has not expired.  */
+        uint32 LOC_controlRegister = SYSTICK->CTRL;                  /* Reading CTRL clears the COUNTFLAG bit. */
+
+        if(BIT_IS_SET(LOC_controlRegister, SYSTICK_CTRL_COUNTFLAG_BIT))
+        {
+            /* The stretched interval has expired and its interrupt is pending, which accounts for one interval
+             * [the counter has been counting the reloaded stretched interval since then]. */
+            LOC_elapsedTicks = G_stretchOffsetTicks + G_stretchedTicks + (G_stretchedTicks - SYSTICK->VAL) - G_intervalTicks;
+        }
+
+        else
+        {
+            /* Another interrupt ended the stretched interval early. */
+            LOC_elapsedTicks = G_stretchOffsetTicks + (G_stretchedTicks - LOC_currentTicks);
+        }
+
+        SYSTICK->LOAD = G_intervalTicks - 1;                         /* Set the normal number of ticks.        */
+        SYSTICK->VAL = 0;                                            /* Restart a whole interval from now.     */
+
+        /* Count the whole elapsed intervals [the wake-up interval itself is left to the timer interrupt], And
+         * carry the rest, So the time of the restarted interval is counted by a later restore. */
+        LOC_elapsedTicks += G_carriedTicks;
+        *a_ptr2elapsedIntervals = LOC_elapsedTicks / G_intervalTicks;
+
+        if(*a_ptr2elapsedIntervals >= G_stretchedIntervals)
+        {
+            *a_ptr2elapsedIntervals = G_stretchedIntervals - 1;
+        }
+
+        G_carriedTicks = LOC_elapsedTicks - (*a_ptr2elapsedIntervals * G_intervalTicks);
+    }
+
+    return LOC_errorStatus;
+}
+
 /*=====================================================================================================================
  * [Function Name] : TIMER_setCallBackFunction
  * [Description]   : Set the address of the call-back function.